@@ -4,4 +4,6 @@
 #include "tcframe/driver/SlugParser.hpp"
 #include "tcframe/driver/RawIOManipulator.hpp"
 #include "tcframe/driver/SpecDriver.hpp"
+#include "tcframe/driver/SpecDriverChannel.hpp"
+#include "tcframe/driver/SpecDriverServer.hpp"
 #include "tcframe/driver/TestCaseDriver.hpp"
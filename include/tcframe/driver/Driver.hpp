@@ -77,7 +77,7 @@ public:
         TestSuite testSuite = testSpec_->buildTestSuite(spec.slug, constraintSuite.getDefinedSubtaskIds());
         SeedSetter* seedSetter = testSpec_->buildSeedSetter();
 
-        auto specDriver = new SpecDriver(testCaseDriver, seedSetter, multipleTestCasesConfig, testSuite);
+        auto specDriver = new SpecDriver(testCaseDriver, seedSetter, multipleTestCasesConfig, move(testSuite));
 
         return make_pair(spec, specDriver);
     }
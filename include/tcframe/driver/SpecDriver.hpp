@@ -1,18 +1,22 @@
 #pragma once
 
-#include <map>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "TestCaseDriver.hpp"
 #include "tcframe/spec.hpp"
 
 using std::istream;
-using std::map;
+using std::make_pair;
 using std::move;
 using std::ostream;
+using std::pair;
+using std::runtime_error;
 using std::string;
+using std::unordered_map;
 
 namespace tcframe {
 
@@ -26,7 +30,9 @@ private:
     MultipleTestCasesConfig multipleTestCasesConfig_;
     TestSuite testSuite_;
 
-    map<string, TestCase> testCasesByName_;
+    // Positions of the test cases in the test suite, as (test group index, test case index). The test
+    // suite itself is never copied.
+    unordered_map<string, pair<int, int>> testCaseIndicesByName_;
 
 public:
     virtual ~SpecDriver() = default;
@@ -41,14 +47,20 @@ public:
             , multipleTestCasesConfig_(move(multipleTestCasesConfig))
             , testSuite_(move(testSuite)) {
 
-        for (auto& testGroup : testSuite_.testGroups()) {
-            for (auto& testCase: testGroup.testCases()) {
-                testCasesByName_[testCase.name()] = testCase;
+        const vector<TestGroup>& testGroups = testSuite_.testGroups();
+        size_t testCaseCount = 0;
+        for (const TestGroup& testGroup : testGroups) {
+            testCaseCount += testGroup.testCases().size();
+        }
+        testCaseIndicesByName_.reserve(testCaseCount);
+        for (int i = 0; i < (int) testGroups.size(); i++) {
+            for (int j = 0; j < (int) testGroups[i].testCases().size(); j++) {
+                testCaseIndicesByName_.emplace(testGroups[i].testCases()[j].name(), make_pair(i, j));
             }
         }
     }
 
-    virtual TestSuite getTestSuite() {
+    virtual const TestSuite& getTestSuite() {
         return testSuite_;
     }
 
@@ -56,6 +68,14 @@ public:
         seedSetter_->setSeed(seed);
     }
 
+    virtual void setThreads(int threads) {
+        testCaseDriver_->setThreads(threads);
+    }
+
+    virtual void setCheckSubtaskAssignment(bool checkSubtaskAssignment) {
+        testCaseDriver_->setCheckSubtaskAssignment(checkSubtaskAssignment);
+    }
+
     virtual bool hasMultipleTestCases() {
         return multipleTestCasesConfig_.counter();
     }
@@ -65,20 +85,37 @@ public:
     }
 
     virtual void generateTestCaseInput(const string& testCaseName, ostream* out) {
-        testCaseDriver_->generateInput(testCasesByName_[testCaseName], out);
+        testCaseDriver_->generateInput(getTestCase(testCaseName), out);
     }
 
     virtual void generateSampleTestCaseOutput(const string& testCaseName, ostream* out) {
-        testCaseDriver_->generateSampleOutput(testCasesByName_[testCaseName], out);
+        testCaseDriver_->generateSampleOutput(getTestCase(testCaseName), out);
     }
 
     virtual void validateTestCaseOutput(istream* in) {
         testCaseDriver_->validateOutput(in);
     }
 
+    virtual void validateTestCaseOutput(istream* input, istream* output) {
+        testCaseDriver_->validateOutput(input, output);
+    }
+
+    virtual void resetMultipleTestCasesAggregates() {
+        testCaseDriver_->resetMultipleTestCasesAggregates();
+    }
+
     virtual void validateMultipleTestCasesInput(int testCaseCount) {
         testCaseDriver_->validateMultipleTestCasesInput(testCaseCount);
     }
+
+private:
+    const TestCase& getTestCase(const string& testCaseName) {
+        auto it = testCaseIndicesByName_.find(testCaseName);
+        if (it == testCaseIndicesByName_.end()) {
+            throw runtime_error("Unknown test case: " + testCaseName);
+        }
+        return testSuite_.testGroups()[it->second.first].testCases()[it->second.second];
+    }
 };
 
 }
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using std::FILE;
+using std::fflush;
+using std::fgetc;
+using std::fprintf;
+using std::fread;
+using std::fscanf;
+using std::fwrite;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * One end of the connection between the runner and a spec driver process. Each message is a list of
+ * fields, framed as the number of fields on its own line, followed by each field as its length on its
+ * own line and then its raw bytes; so fields may contain anything, including newlines.
+ */
+class SpecDriverChannel {
+private:
+    FILE* in_;
+    FILE* out_;
+
+public:
+    virtual ~SpecDriverChannel() = default;
+
+    SpecDriverChannel(FILE* in, FILE* out)
+            : in_(in)
+            , out_(out) {}
+
+    virtual void send(const vector<string>& fields) {
+        fprintf(out_, "%d\n", (int) fields.size());
+        for (const string& field : fields) {
+            fprintf(out_, "%d\n", (int) field.size());
+            fwrite(field.data(), 1, field.size(), out_);
+        }
+        fflush(out_);
+    }
+
+    // Returns false if the other end has been closed.
+    virtual bool receive(vector<string>& fields) {
+        int count;
+        if (!readLength(count)) {
+            return false;
+        }
+        fields.assign(count, "");
+        for (string& field : fields) {
+            int length;
+            if (!readLength(length)) {
+                return false;
+            }
+            field.resize(length);
+            if (length > 0 && fread(&field[0], 1, length, in_) != (size_t) length) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    bool readLength(int& length) {
+        if (fscanf(in_, "%d", &length) != 1 || length < 0) {
+            return false;
+        }
+        return fgetc(in_) == '\n';
+    }
+};
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SpecDriver.hpp"
+#include "SpecDriverChannel.hpp"
+#include "tcframe/exception.hpp"
+#include "tcframe/util.hpp"
+
+using std::ifstream;
+using std::ofstream;
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Serves the spec driver to the runner, one request at a time, until the channel is closed. A request
+ * is the name of a SpecDriver method followed by its arguments, where streams are given as filenames.
+ * The response is "ok", or the error thrown: "error" followed by its message, or "formatted_error"
+ * followed by the level and message of each line.
+ */
+class SpecDriverServer {
+private:
+    SpecDriver* specDriver_;
+    SpecDriverChannel* channel_;
+
+public:
+    virtual ~SpecDriverServer() = default;
+
+    SpecDriverServer(SpecDriver* specDriver, SpecDriverChannel* channel)
+            : specDriver_(specDriver)
+            , channel_(channel) {}
+
+    void serve() {
+        vector<string> request;
+        while (channel_->receive(request)) {
+            vector<string> response;
+            try {
+                handle(request);
+                response = {"ok"};
+            } catch (FormattedError& e) {
+                response = {"formatted_error"};
+                for (const pair<int, string>& message : e.messages()) {
+                    response.push_back(StringUtils::toString(message.first));
+                    response.push_back(message.second);
+                }
+            } catch (runtime_error& e) {
+                response = {"error", e.what()};
+            }
+            channel_->send(response);
+        }
+    }
+
+private:
+    void handle(const vector<string>& request) {
+        string method = request.empty() ? "" : request[0];
+        if (method == "setSeed" && request.size() == 2) {
+            specDriver_->setSeed(toNumber<unsigned>(request[1]));
+        } else if (method == "setThreads" && request.size() == 2) {
+            specDriver_->setThreads(toNumber<int>(request[1]));
+        } else if (method == "setCheckSubtaskAssignment" && request.size() == 2) {
+            specDriver_->setCheckSubtaskAssignment(request[1] == "1");
+        } else if (method == "generateTestCaseInput" && request.size() == 3) {
+            ofstream out(request[2]);
+            checkWritten(out, request[2]);
+            specDriver_->generateTestCaseInput(request[1], &out);
+            out.close();
+            checkWritten(out, request[2]);
+        } else if (method == "generateSampleTestCaseOutput" && request.size() == 3) {
+            ofstream out(request[2]);
+            checkWritten(out, request[2]);
+            specDriver_->generateSampleTestCaseOutput(request[1], &out);
+            out.close();
+            checkWritten(out, request[2]);
+        } else if (method == "validateTestCaseOutput" && request.size() == 2) {
+            ifstream in(request[1]);
+            specDriver_->validateTestCaseOutput(&in);
+        } else if (method == "validateTestCaseOutput" && request.size() == 3) {
+            ifstream input(request[1]);
+            ifstream output(request[2]);
+            specDriver_->validateTestCaseOutput(&input, &output);
+        } else if (method == "resetMultipleTestCasesAggregates" && request.size() == 1) {
+            specDriver_->resetMultipleTestCasesAggregates();
+        } else if (method == "validateMultipleTestCasesInput" && request.size() == 2) {
+            specDriver_->validateMultipleTestCasesInput(toNumber<int>(request[1]));
+        } else {
+            throw runtime_error("Unknown spec driver request: " + method);
+        }
+    }
+
+    static void checkWritten(const ofstream& out, const string& filename) {
+        if (!out) {
+            throw runtime_error("Cannot write " + filename);
+        }
+    }
+
+    template<typename T>
+    static T toNumber(const string& s) {
+        optional<T> number = StringUtils::toNumber<T>(s);
+        if (!number) {
+            throw runtime_error("Invalid number in spec driver request: " + s);
+        }
+        return number.value();
+    }
+};
+
+}
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <istream>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "RawIOManipulator.hpp"
 #include "tcframe/exception.hpp"
@@ -15,11 +17,14 @@
 #include "tcframe/util.hpp"
 
 using std::endl;
+using std::getline;
 using std::istream;
+using std::max;
 using std::move;
 using std::ostream;
 using std::runtime_error;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
@@ -30,6 +35,10 @@ private:
     Verifier* verifier_;
     MultipleTestCasesConfig multipleTestCasesConfig_;
 
+    // Running values of the multiple test cases aggregates, over the test cases generated so far.
+    vector<long long> aggregateValues_;
+    int aggregatedTestCaseCount_ = 0;
+
 public:
     virtual ~TestCaseDriver() = default;
 
@@ -43,9 +52,18 @@ public:
             , verifier_(verifier)
             , multipleTestCasesConfig_(move(multipleTestCasesConfig)) {}
 
+    virtual void setThreads(int threads) {
+        ioManipulator_->setThreads(threads);
+    }
+
+    virtual void setCheckSubtaskAssignment(bool checkSubtaskAssignment) {
+        verifier_->setCheckSubtaskAssignment(checkSubtaskAssignment);
+    }
+
     virtual void generateInput(const TestCase& testCase, ostream* out) {
         applyInput(testCase);
         verifyInput(testCase);
+        accumulateAggregates();
         writeInput(testCase, out);
     }
 
@@ -58,9 +76,27 @@ public:
         applyOutput(in);
     }
 
+    // Validates the output of a test case other than the one generated last, by first restoring the
+    // input variables from its generated input. Other spec state is not restored, so the output format
+    // must only depend on the input variables.
+    virtual void validateOutput(istream* input, istream* output) {
+        restoreInput(input);
+        applyOutput(output);
+    }
+
+    virtual void resetMultipleTestCasesAggregates() {
+        aggregateValues_.clear();
+        aggregatedTestCaseCount_ = 0;
+    }
+
     virtual void validateMultipleTestCasesInput(int testCaseCount) {
         *multipleTestCasesConfig_.counter().value() = testCaseCount;
 
+        const vector<MultipleTestCasesAggregate>& aggregates = multipleTestCasesConfig_.aggregates();
+        for (int i = 0; i < aggregates.size(); i++) {
+            *aggregates[i].var() = aggregatedTestCaseCount_ > 0 ? aggregateValues_[i] : 0;
+        }
+
         MultipleTestCasesConstraintsVerificationResult result = verifier_->verifyMultipleTestCasesConstraints();
         if (!result.isValid()) {
             throw result.asFormattedError();
@@ -86,6 +122,21 @@ private:
         }
     }
 
+    void accumulateAggregates() {
+        const vector<MultipleTestCasesAggregate>& aggregates = multipleTestCasesConfig_.aggregates();
+        aggregateValues_.resize(aggregates.size(), 0);
+        for (int i = 0; i < aggregates.size(); i++) {
+            long long quantity = aggregates[i].quantity()();
+            long long& value = aggregateValues_[i];
+            if (aggregates[i].type() == AggregateType::MAX) {
+                value = aggregatedTestCaseCount_ == 0 ? quantity : max(value, quantity);
+            } else {
+                value += quantity;
+            }
+        }
+        aggregatedTestCaseCount_++;
+    }
+
     void writeInput(const TestCase& testCase, ostream* out) {
         if (multipleTestCasesConfig_.counter()) {
             int testCaseCount = 1;
@@ -116,6 +167,14 @@ private:
         rawIOManipulator_->print(out, data->output().value());
     }
 
+    void restoreInput(istream* in) {
+        if (multipleTestCasesConfig_.counter()) {
+            string testCaseCount;
+            getline(*in, testCaseCount);
+        }
+        ioManipulator_->parseInput(in);
+    }
+
     void applyOutput(istream* in) {
         if (multipleTestCasesConfig_.counter() && multipleTestCasesConfig_.outputPrefix()) {
             string firstOutputPrefix = StringUtils::interpolate(multipleTestCasesConfig_.outputPrefix().value(), 1);
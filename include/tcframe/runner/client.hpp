@@ -1,3 +1,4 @@
 #pragma once
 
+#include "tcframe/runner/client/RemoteSpecClient.hpp"
 #include "tcframe/runner/client/SpecClient.hpp"
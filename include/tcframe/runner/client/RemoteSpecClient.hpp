@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SpecClient.hpp"
+#include "tcframe/driver.hpp"
+#include "tcframe/exception.hpp"
+#include "tcframe/runner/os.hpp"
+#include "tcframe/util.hpp"
+
+using std::pair;
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Spec client whose test data generation and validation run in a persistent spec driver process
+ * (see SpecDriverServer), which keeps the spec state isolated from the runner. The test suite and the
+ * multiple test cases config are still read from the local spec driver, as they are the same in both.
+ */
+class RemoteSpecClient : public SpecClient {
+private:
+    SpecDriverChannel* channel_;
+
+public:
+    virtual ~RemoteSpecClient() = default;
+
+    RemoteSpecClient(SpecDriver* specDriver, OperatingSystem* os, SpecDriverChannel* channel)
+            : SpecClient(specDriver, os)
+            , channel_(channel) {}
+
+    void setSeed(unsigned seed) {
+        call({"setSeed", StringUtils::toString(seed)});
+    }
+
+    void setThreads(int threads) {
+        call({"setThreads", StringUtils::toString(threads)});
+    }
+
+    void setCheckSubtaskAssignment(bool checkSubtaskAssignment) {
+        call({"setCheckSubtaskAssignment", checkSubtaskAssignment ? "1" : "0"});
+    }
+
+    void generateTestCaseInput(const string& testCaseName, const string& filename) {
+        call({"generateTestCaseInput", testCaseName, filename});
+    }
+
+    void generateSampleTestCaseOutput(const string& testCaseName, const string& filename) {
+        call({"generateSampleTestCaseOutput", testCaseName, filename});
+    }
+
+    void validateTestCaseOutput(const string& filename) {
+        call({"validateTestCaseOutput", filename});
+    }
+
+    void validateTestCaseOutput(const string& inputFilename, const string& outputFilename) {
+        call({"validateTestCaseOutput", inputFilename, outputFilename});
+    }
+
+    void resetMultipleTestCasesAggregates() {
+        call({"resetMultipleTestCasesAggregates"});
+    }
+
+    void validateMultipleTestCasesInput(int testCaseCount) {
+        call({"validateMultipleTestCasesInput", StringUtils::toString(testCaseCount)});
+    }
+
+private:
+    void call(const vector<string>& request) {
+        channel_->send(request);
+
+        vector<string> response;
+        if (!channel_->receive(response) || response.empty()) {
+            throw runtime_error("Spec driver process terminated unexpectedly");
+        }
+        if (response[0] == "error" && response.size() == 2) {
+            throw runtime_error(response[1]);
+        }
+        if (response[0] == "formatted_error") {
+            vector<pair<int, string>> messages;
+            for (size_t i = 1; i + 1 < response.size(); i += 2) {
+                messages.emplace_back(StringUtils::toNumber<int>(response[i]).value_or(0), response[i + 1]);
+            }
+            throw FormattedError(messages);
+        }
+        if (response[0] != "ok") {
+            throw runtime_error("Invalid spec driver response: " + response[0]);
+        }
+    }
+};
+
+}
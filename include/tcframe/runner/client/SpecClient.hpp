@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <istream>
 #include <ostream>
 #include <string>
@@ -11,6 +12,7 @@
 using std::istream;
 using std::ostream;
 using std::string;
+using std::uint64_t;
 
 namespace tcframe {
 
@@ -27,7 +29,7 @@ public:
             : specDriver_(specDriver)
             , os_(os) {}
 
-    virtual TestSuite getTestSuite() {
+    virtual const TestSuite& getTestSuite() {
         return specDriver_->getTestSuite();
     }
 
@@ -35,6 +37,14 @@ public:
         specDriver_->setSeed(seed);
     }
 
+    virtual void setThreads(int threads) {
+        specDriver_->setThreads(threads);
+    }
+
+    virtual void setCheckSubtaskAssignment(bool checkSubtaskAssignment) {
+        specDriver_->setCheckSubtaskAssignment(checkSubtaskAssignment);
+    }
+
     virtual bool hasMultipleTestCases() {
         return specDriver_->hasMultipleTestCases();
     }
@@ -44,11 +54,31 @@ public:
     }
 
     virtual void generateTestCaseInput(const string& testCaseName, const string& filename) {
-        ostream* out = os_->openForWriting(filename);
-        specDriver_->generateTestCaseInput(testCaseName, out);
+        ostream* out = os_->openForBackgroundWriting(filename);
+        try {
+            specDriver_->generateTestCaseInput(testCaseName, out);
+        } catch (...) {
+            os_->closeOpenedStream(out);
+            throw;
+        }
         os_->closeOpenedStream(out);
     }
 
+    // Waits until the input generated by generateTestCaseInput() has been written, and returns the hash of
+    // its content. Throws if it could not be written.
+    virtual uint64_t waitForTestCaseInput(const string& filename) {
+        optional<uint64_t> contentHash = os_->waitForBackgroundWriting(filename);
+        if (contentHash) {
+            return contentHash.value();
+        }
+
+        // The input was written by someone else, e.g. a spec driver process.
+        istream* in = os_->openForReading(filename);
+        uint64_t hash = ContentHasher::hash(in);
+        os_->closeOpenedStream(in);
+        return hash;
+    }
+
     virtual void generateSampleTestCaseOutput(const string& testCaseName, const string& filename) {
         ostream* out = os_->openForWriting(filename);
         specDriver_->generateSampleTestCaseOutput(testCaseName, out);
@@ -56,11 +86,23 @@ public:
     }
 
     virtual void validateTestCaseOutput(const string& filename) {
-        istream* in = os_->openForReading(filename);
+        istream* in = os_->openForMappedReading(filename);
         specDriver_->validateTestCaseOutput(in);
         os_->closeOpenedStream(in);
     }
 
+    virtual void validateTestCaseOutput(const string& inputFilename, const string& outputFilename) {
+        istream* input = os_->openForMappedReading(inputFilename);
+        istream* output = os_->openForMappedReading(outputFilename);
+        specDriver_->validateTestCaseOutput(input, output);
+        os_->closeOpenedStream(input);
+        os_->closeOpenedStream(output);
+    }
+
+    virtual void resetMultipleTestCasesAggregates() {
+        specDriver_->resetMultipleTestCasesAggregates();
+    }
+
     virtual void validateMultipleTestCasesInput(int testCaseCount) {
         specDriver_->validateMultipleTestCasesInput(testCaseCount);
     }
@@ -14,20 +14,26 @@ struct Args {
 public:
     enum class Command {
         GENERATE,
-        GRADE
+        GRADE,
+        DRIVER
     };
 
 private:
     Command command_;
 
     bool brief_ = false;
+    bool collapseDuplicates_ = false;
     optional<string> communicator_;
+    optional<int> jobs_;
     optional<int> memoryLimit_;
     bool noMemoryLimit_ = false;
+    bool noSubtaskAssignmentCheck_ = false;
     bool noTimeLimit_ = false;
     optional<string> scorer_;
     optional<unsigned> seed_;
     optional<string> solution_;
+    bool specDriverProcess_ = false;
+    optional<int> threads_;
     optional<int> timeLimit_;
     optional<string> output_;
 
@@ -40,10 +46,18 @@ public:
         return brief_;
     }
 
+    bool collapseDuplicates() const {
+        return collapseDuplicates_;
+    }
+
     const optional<string>& communicator() const {
         return communicator_;
     }
 
+    const optional<int>& jobs() const {
+        return jobs_;
+    }
+
     const optional<int>& memoryLimit() const {
         return memoryLimit_;
     }
@@ -52,6 +66,10 @@ public:
         return noMemoryLimit_;
     }
 
+    bool noSubtaskAssignmentCheck() const {
+        return noSubtaskAssignmentCheck_;
+    }
+
     bool noTimeLimit() const {
         return noTimeLimit_;
     }
@@ -72,6 +90,14 @@ public:
         return solution_;
     }
 
+    bool specDriverProcess() const {
+        return specDriverProcess_;
+    }
+
+    const optional<int>& threads() const {
+        return threads_;
+    }
+
     const optional<int>& timeLimit() const {
         return timeLimit_;
     }
@@ -20,16 +20,21 @@ public:
 
     static Args parse(int argc, char* argv[]) {
         option longopts[] = {
-                { "brief",           no_argument,       nullptr, 'a'},
-                { "communicator",    required_argument, nullptr, 'b'},
-                { "memory-limit",    required_argument, nullptr, 'c'},
-                { "no-memory-limit", no_argument      , nullptr, 'd'},
-                { "no-time-limit",   no_argument      , nullptr, 'e'},
-                { "output",          required_argument, nullptr, 'f'},
-                { "scorer",          required_argument, nullptr, 'g'},
-                { "seed",            required_argument, nullptr, 'h'},
-                { "solution",        required_argument, nullptr, 'i'},
-                { "time-limit",      required_argument, nullptr, 'j'},
+                { "brief",                       no_argument      , nullptr, 'a'},
+                { "collapse-duplicates",         no_argument      , nullptr, 'b'},
+                { "communicator",                required_argument, nullptr, 'c'},
+                { "jobs",                        required_argument, nullptr, 'd'},
+                { "memory-limit",                required_argument, nullptr, 'e'},
+                { "no-memory-limit",             no_argument      , nullptr, 'f'},
+                { "no-subtask-assignment-check", no_argument      , nullptr, 'g'},
+                { "no-time-limit",               no_argument      , nullptr, 'h'},
+                { "output",                      required_argument, nullptr, 'i'},
+                { "scorer",                      required_argument, nullptr, 'j'},
+                { "seed",                        required_argument, nullptr, 'k'},
+                { "solution",                    required_argument, nullptr, 'l'},
+                { "spec-driver-process",         no_argument      , nullptr, 'm'},
+                { "threads",                     required_argument, nullptr, 'n'},
+                { "time-limit",                  required_argument, nullptr, 'o'},
                 { 0, 0, 0, 0 }};
 
         Args args;
@@ -38,6 +43,10 @@ public:
             args.command_ = Args::Command::GRADE;
             argc--;
             argv++;
+        } else if (argc >= 2 && strcmp(argv[1], "driver") == 0) {
+            args.command_ = Args::Command::DRIVER;
+            argc--;
+            argv++;
         }
 
         optind = 1;
@@ -50,30 +59,45 @@ public:
                     args.brief_ = true;
                     break;
                 case 'b':
-                    args.communicator_ = optional<string>(optarg);
+                    args.collapseDuplicates_ = true;
                     break;
                 case 'c':
-                    args.memoryLimit_ = StringUtils::toNumber<int>(optarg);
+                    args.communicator_ = optional<string>(optarg);
                     break;
                 case 'd':
-                    args.noMemoryLimit_ = true;
+                    args.jobs_ = StringUtils::toNumber<int>(optarg);
                     break;
                 case 'e':
-                    args.noTimeLimit_ = true;
+                    args.memoryLimit_ = StringUtils::toNumber<int>(optarg);
                     break;
                 case 'f':
-                    args.output_ = optional<string>(optarg);
+                    args.noMemoryLimit_ = true;
                     break;
                 case 'g':
-                    args.scorer_ = optional<string>(optarg);
+                    args.noSubtaskAssignmentCheck_ = true;
                     break;
                 case 'h':
-                    args.seed_ = StringUtils::toNumber<unsigned>(optarg);
+                    args.noTimeLimit_ = true;
                     break;
                 case 'i':
-                    args.solution_ = optional<string>(optarg);
+                    args.output_ = optional<string>(optarg);
                     break;
                 case 'j':
+                    args.scorer_ = optional<string>(optarg);
+                    break;
+                case 'k':
+                    args.seed_ = StringUtils::toNumber<unsigned>(optarg);
+                    break;
+                case 'l':
+                    args.solution_ = optional<string>(optarg);
+                    break;
+                case 'm':
+                    args.specDriverProcess_ = true;
+                    break;
+                case 'n':
+                    args.threads_ = StringUtils::toNumber<int>(optarg);
+                    break;
+                case 'o':
                     args.timeLimit_ = StringUtils::toNumber<int>(optarg);
                     break;
                 case ':':
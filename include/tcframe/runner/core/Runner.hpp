@@ -23,6 +23,8 @@ namespace tcframe {
 
 struct RunnerDefaults {
     static constexpr unsigned SEED = 0;
+    static constexpr int THREADS = 1;
+    static constexpr int JOBS = 1;
     static constexpr const char* OUTPUT_DIR = "tc";
     static constexpr const char* SOLUTION_COMMAND = "./solution";
     static constexpr const char* SCORER_COMMAND = "./scorer";
@@ -71,7 +73,10 @@ public:
         try {
             Args args = parseArgs(argc, argv);
             pair<SpecYaml, SpecDriver*> spec = buildSpec(runnerLogger);
-            auto specClient = new SpecClient(spec.second, os_);
+            if (args.command() == Args::Command::DRIVER) {
+                return serve(spec.second);
+            }
+            SpecClient* specClient = createSpecClient(args, spec.second, argv[0]);
 
             int result;
             if (args.command() == Args::Command::GENERATE) {
@@ -108,6 +113,9 @@ private:
     int generate(const Args& args, const SpecYaml& spec, SpecClient* specClient) {
         auto optionsBuilder = GenerationOptionsBuilder(spec.slug)
                 .setSeed(args.seed().value_or(unsigned(RunnerDefaults::SEED)))
+                .setThreads(args.threads().value_or(int(RunnerDefaults::THREADS)))
+                .setJobs(args.jobs().value_or(int(RunnerDefaults::JOBS)))
+                .setCheckSubtaskAssignment(!args.noSubtaskAssignmentCheck())
                 .setSolutionCommand(args.solution().value_or(string(RunnerDefaults::SOLUTION_COMMAND)))
                 .setOutputDir(args.output().value_or(string(RunnerDefaults::OUTPUT_DIR)));
 
@@ -132,7 +140,8 @@ private:
     int grade(const Args& args, const SpecYaml& spec, SpecClient* specClient) {
         auto optionsBuilder = GradingOptionsBuilder(spec.slug)
                 .setSolutionCommand(args.solution().value_or(string(RunnerDefaults::SOLUTION_COMMAND)))
-                .setOutputDir(args.output().value_or(string(RunnerDefaults::OUTPUT_DIR)));
+                .setOutputDir(args.output().value_or(string(RunnerDefaults::OUTPUT_DIR)))
+                .setCollapseDuplicates(args.collapseDuplicates());
 
         if (!args.noTimeLimit()) {
             optionsBuilder.setTimeLimit(args.timeLimit().value_or(spec.limits.time_s));
@@ -154,12 +163,29 @@ private:
         auto evaluator = evaluatorRegistry_->get(spec.evaluator.slug, os_, helperCommands);
         auto testCaseGrader = new TestCaseGrader(evaluator, logger);
         auto aggregator = aggregatorRegistry_->get(!spec.subtasks.empty());
-        auto grader = graderFactory_->create(specClient, testCaseGrader, aggregator, logger);
+        auto grader = graderFactory_->create(specClient, testCaseGrader, aggregator, os_, logger);
 
         grader->grade(options);
         return 0;
     }
 
+    // Grading only reads the test suite, which the local spec driver has, so it never starts the process.
+    SpecClient* createSpecClient(const Args& args, SpecDriver* specDriver, const string& runnerCommand) {
+        if (!args.specDriverProcess() || args.command() != Args::Command::GENERATE) {
+            return new SpecClient(specDriver, os_);
+        }
+        pair<FILE*, FILE*> streams = os_->startProcess(runnerCommand, {"driver"});
+        return new RemoteSpecClient(specDriver, os_, new SpecDriverChannel(streams.first, streams.second));
+    }
+
+    // Runs as the spec driver process of another runner, until that runner closes the connection.
+    int serve(SpecDriver* specDriver) {
+        pair<FILE*, FILE*> streams = os_->takeStandardStreams();
+        SpecDriverChannel channel(streams.first, streams.second);
+        SpecDriverServer(specDriver, &channel).serve();
+        return 0;
+    }
+
     void cleanUp() {
         os_->execute(ExecutionRequestBuilder().setCommand("rm __tcframe_*").build());
     }
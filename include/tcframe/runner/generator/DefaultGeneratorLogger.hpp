@@ -8,6 +8,7 @@
 #include "GeneratorLogger.hpp"
 #include "tcframe/runner/logger.hpp"
 #include "tcframe/spec/constraint.hpp"
+#include "tcframe/spec/testcase.hpp"
 #include "tcframe/spec/verifier.hpp"
 #include "tcframe/util.hpp"
 
@@ -62,6 +63,21 @@ public:
         engine_->logParagraph(0, "FAILED");
         engine_->logParagraph(2, "Reasons:");
     }
+
+    void logDuplicateTestCases(const vector<vector<TestCase>>& duplicateTestCases) {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Found duplicate test cases:");
+        for (const vector<TestCase>& testCases : duplicateTestCases) {
+            engine_->logParagraph(1, "Identical inputs:");
+            for (const TestCase& testCase : testCases) {
+                if (testCase.description()) {
+                    engine_->logParagraph(2, testCase.name() + ": " + testCase.description().value());
+                } else {
+                    engine_->logParagraph(2, testCase.name());
+                }
+            }
+        }
+    }
 };
 
 }
@@ -18,9 +18,12 @@ struct GenerationOptions {
 private:
     string slug_;
     unsigned seed_;
+    int threads_ = 1;
+    int jobs_ = 1;
     string solutionCommand_;
     string outputDir_;
     bool hasTcOutput_;
+    bool checkSubtaskAssignment_ = true;
 
 public:
     const string& slug() const {
@@ -31,6 +34,14 @@ public:
         return seed_;
     }
 
+    int threads() const {
+        return threads_;
+    }
+
+    int jobs() const {
+        return jobs_;
+    }
+
     const string& solutionCommand() const {
         return solutionCommand_;
     }
@@ -43,9 +54,15 @@ public:
         return hasTcOutput_;
     }
 
+    bool checkSubtaskAssignment() const {
+        return checkSubtaskAssignment_;
+    }
+
     bool operator==(const GenerationOptions& o) const {
-        return tie(slug_, seed_, solutionCommand_, outputDir_, hasTcOutput_) ==
-                tie(o.slug_, o.seed_, o.solutionCommand_, o.outputDir_, o.hasTcOutput_);
+        return tie(slug_, seed_, threads_, jobs_, solutionCommand_, outputDir_, hasTcOutput_,
+                   checkSubtaskAssignment_) ==
+                tie(o.slug_, o.seed_, o.threads_, o.jobs_, o.solutionCommand_, o.outputDir_, o.hasTcOutput_,
+                    o.checkSubtaskAssignment_);
     }
 };
 
@@ -66,6 +83,16 @@ public:
         return *this;
     }
 
+    GenerationOptionsBuilder& setThreads(int threads) {
+        subject_.threads_ = threads;
+        return *this;
+    }
+
+    GenerationOptionsBuilder& setJobs(int jobs) {
+        subject_.jobs_ = jobs;
+        return *this;
+    }
+
     GenerationOptionsBuilder& setSolutionCommand(string solutionCommand) {
         subject_.solutionCommand_ = move(solutionCommand);
         return *this;
@@ -81,6 +108,11 @@ public:
         return *this;
     }
 
+    GenerationOptionsBuilder& setCheckSubtaskAssignment(bool checkSubtaskAssignment) {
+        subject_.checkSubtaskAssignment_ = checkSubtaskAssignment;
+        return *this;
+    }
+
     GenerationOptions build() {
         return move(subject_);
     }
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "GenerationOptions.hpp"
 #include "GeneratorLogger.hpp"
@@ -13,7 +17,11 @@
 #include "tcframe/util.hpp"
 
 using std::ostringstream;
+using std::pair;
 using std::string;
+using std::uint64_t;
+using std::unordered_map;
+using std::vector;
 
 namespace tcframe {
 
@@ -40,17 +48,26 @@ public:
     virtual bool generate(const GenerationOptions& options) {
         logger_->logIntroduction();
 
-        TestSuite testSuite = specClient_->getTestSuite();
+        const TestSuite& testSuite = specClient_->getTestSuite();
         bool hasMultipleTestCases = specClient_->hasMultipleTestCases();
         optional<string> multipleTestCasesOutputPrefix = specClient_->getMultipleTestCasesOutputPrefix();
 
         specClient_->setSeed(options.seed());
+        specClient_->setThreads(options.threads());
+        specClient_->setCheckSubtaskAssignment(options.checkSubtaskAssignment());
 
         os_->forceMakeDir(options.outputDir());
 
         bool successful = true;
+        vector<pair<uint64_t, const TestCase*>> inputHashes;
         for (const TestGroup& testGroup : testSuite.testGroups()) {
-            successful &= generateTestGroup(testGroup, options, hasMultipleTestCases, multipleTestCasesOutputPrefix);
+            successful &= generateTestGroup(
+                    testGroup, options, hasMultipleTestCases, multipleTestCasesOutputPrefix, inputHashes);
+        }
+
+        vector<vector<TestCase>> duplicateTestCases = findDuplicateTestCases(inputHashes);
+        if (!duplicateTestCases.empty()) {
+            logger_->logDuplicateTestCases(duplicateTestCases);
         }
         if (successful) {
             logger_->logSuccessfulResult();
@@ -65,13 +82,24 @@ private:
             const TestGroup& testGroup,
             const GenerationOptions& options,
             bool hasMultipleTestCases,
-            optional<string> multipleTestCasesOutputPrefix) {
+            optional<string> multipleTestCasesOutputPrefix,
+            vector<pair<uint64_t, const TestCase*>>& inputHashes) {
 
         logger_->logTestGroupIntroduction(testGroup.id());
 
+        if (hasMultipleTestCases) {
+            specClient_->resetMultipleTestCasesAggregates();
+        }
+
         bool successful = true;
-        for (const TestCase& testCase : testGroup.testCases()) {
-            successful &= testCaseGenerator_->generate(testCase, options);
+        const vector<TestCase>& testCases = testGroup.testCases();
+        vector<optional<uint64_t>> results = testCaseGenerator_->generate(testCases, options);
+        for (int i = 0; i < (int) testCases.size(); i++) {
+            if (results[i]) {
+                inputHashes.emplace_back(results[i].value(), &testCases[i]);
+            } else {
+                successful = false;
+            }
         }
         if (successful && hasMultipleTestCases && !testGroup.testCases().empty()) {
             return combineMultipleTestCases(testGroup, options, multipleTestCasesOutputPrefix);
@@ -79,6 +107,31 @@ private:
         return successful;
     }
 
+    // Groups the test cases by input hash, keeping those groups with more than one test case, in the
+    // order of their first test cases.
+    static vector<vector<TestCase>> findDuplicateTestCases(const vector<pair<uint64_t, const TestCase*>>& inputHashes) {
+        unordered_map<uint64_t, int> groupIndices;
+        vector<vector<const TestCase*>> groups;
+        for (const pair<uint64_t, const TestCase*>& entry : inputHashes) {
+            auto inserted = groupIndices.emplace(entry.first, (int) groups.size());
+            if (inserted.second) {
+                groups.emplace_back();
+            }
+            groups[inserted.first->second].push_back(entry.second);
+        }
+
+        vector<vector<TestCase>> duplicateTestCases;
+        for (const vector<const TestCase*>& group : groups) {
+            if (group.size() > 1) {
+                duplicateTestCases.emplace_back();
+                for (const TestCase* testCase : group) {
+                    duplicateTestCases.back().push_back(*testCase);
+                }
+            }
+        }
+        return duplicateTestCases;
+    }
+
     bool combineMultipleTestCases(
             const TestGroup& testGroup,
             const GenerationOptions& options,
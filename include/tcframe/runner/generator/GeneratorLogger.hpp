@@ -7,6 +7,7 @@
 
 #include "tcframe/runner/logger.hpp"
 #include "tcframe/spec/constraint.hpp"
+#include "tcframe/spec/testcase.hpp"
 #include "tcframe/spec/verifier.hpp"
 #include "tcframe/util.hpp"
 
@@ -28,6 +29,7 @@ public:
     virtual void logMultipleTestCasesCombinationIntroduction(const string& testGroupName) = 0;
     virtual void logMultipleTestCasesCombinationSuccessfulResult() = 0;
     virtual void logMultipleTestCasesCombinationFailedResult() = 0;
+    virtual void logDuplicateTestCases(const vector<vector<TestCase>>& duplicateTestCases) = 0;
 };
 
 }
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "GenerationOptions.hpp"
 #include "GeneratorLogger.hpp"
@@ -11,13 +17,34 @@
 #include "tcframe/runner/verdict.hpp"
 #include "tcframe/spec/testcase.hpp"
 
+using std::async;
+using std::current_exception;
+using std::deque;
+using std::exception_ptr;
+using std::future;
+using std::launch;
+using std::move;
+using std::rethrow_exception;
 using std::runtime_error;
 using std::string;
+using std::uint64_t;
+using std::vector;
 
 namespace tcframe {
 
 class TestCaseGenerator {
 private:
+    // An official test case whose input has been generated, and whose solution may still be running.
+    struct PendingTestCase {
+        int index;
+        const TestCase* testCase;
+        string inputFilename;
+        string outputFilename;
+        uint64_t inputHash;
+        exception_ptr inputError;
+        future<GenerationResult> generationResult;
+    };
+
     SpecClient* specClient_;
     Evaluator* evaluator_;
     GeneratorLogger* logger_;
@@ -33,29 +60,125 @@ public:
             , evaluator_(evaluator)
             , logger_(logger) {}
 
-    virtual bool generate(const TestCase& testCase, const GenerationOptions& options) {
+    // Returns the hash of the input of the test case, if it was successfully generated.
+    virtual optional<uint64_t> generate(const TestCase& testCase, const GenerationOptions& options) {
         logger_->logTestCaseIntroduction(testCase.name());
 
         string inputFilename = TestCasePathCreator::createInputPath(testCase.name(), options.outputDir());
         string outputFilename = TestCasePathCreator::createOutputPath(testCase.name(), options.outputDir());
 
+        uint64_t inputHash;
         try {
-            generateInput(testCase, inputFilename);
+            inputHash = generateInput(testCase, inputFilename);
             generateOutput(testCase, inputFilename, outputFilename, options);
             validateOutput(testCase, inputFilename, outputFilename, options);
         } catch (runtime_error& e) {
             logger_->logTestCaseFailedResult(testCase.description());
             logger_->logError(&e);
-            return false;
+            return optional<uint64_t>();
         }
 
         logger_->logTestCaseSuccessfulResult();
-        return true;
+        return optional<uint64_t>(inputHash);
+    }
+
+    // Generates the test cases in order, and returns the hash of the input of each of them that was
+    // successfully generated.
+    // With more than one job, the inputs are generated while the solution runs on up to that many of
+    // the previous official test cases; their outputs are then validated and logged in order, after
+    // restoring their inputs. Sample test cases are still generated one at a time.
+    virtual vector<optional<uint64_t>> generate(const vector<TestCase>& testCases, const GenerationOptions& options) {
+        vector<optional<uint64_t>> results(testCases.size());
+        if (options.jobs() <= 1) {
+            for (int i = 0; i < (int) testCases.size(); i++) {
+                results[i] = generate(testCases[i], options);
+            }
+            return results;
+        }
+
+        deque<PendingTestCase> pendingTestCases;
+        for (int i = 0; i < (int) testCases.size(); i++) {
+            if (testCases[i].data()->type() == TestCaseDataType::SAMPLE) {
+                finishAll(pendingTestCases, options, results);
+                results[i] = generate(testCases[i], options);
+                continue;
+            }
+
+            PendingTestCase pendingTestCase = start(i, testCases[i], options);
+            if ((int) pendingTestCases.size() >= options.jobs()) {
+                results[pendingTestCases.front().index] = finish(pendingTestCases.front(), options);
+                pendingTestCases.pop_front();
+            }
+            pendingTestCases.push_back(move(pendingTestCase));
+        }
+        finishAll(pendingTestCases, options, results);
+        return results;
     }
 
 private:
-    void generateInput(const TestCase& testCase, const string& inputFilename) {
+    PendingTestCase start(int index, const TestCase& testCase, const GenerationOptions& options) {
+        PendingTestCase pendingTestCase;
+        pendingTestCase.index = index;
+        pendingTestCase.testCase = &testCase;
+        pendingTestCase.inputFilename = TestCasePathCreator::createInputPath(testCase.name(), options.outputDir());
+        pendingTestCase.outputFilename = TestCasePathCreator::createOutputPath(testCase.name(), options.outputDir());
+
+        try {
+            pendingTestCase.inputHash = generateInput(testCase, pendingTestCase.inputFilename);
+        } catch (runtime_error&) {
+            pendingTestCase.inputError = current_exception();
+            return pendingTestCase;
+        }
+
+        if (options.hasTcOutput()) {
+            Evaluator* evaluator = evaluator_;
+            string inputFilename = pendingTestCase.inputFilename;
+            string outputFilename = pendingTestCase.outputFilename;
+            EvaluationOptions evaluationOptions = createEvaluationOptions(options);
+            pendingTestCase.generationResult = async(launch::async, [=] {
+                return evaluator->generate(inputFilename, outputFilename, evaluationOptions);
+            });
+        }
+        return pendingTestCase;
+    }
+
+    optional<uint64_t> finish(PendingTestCase& pendingTestCase, const GenerationOptions& options) {
+        const TestCase& testCase = *pendingTestCase.testCase;
+        logger_->logTestCaseIntroduction(testCase.name());
+
+        try {
+            if (pendingTestCase.inputError) {
+                rethrow_exception(pendingTestCase.inputError);
+            }
+            if (options.hasTcOutput()) {
+                checkGenerationResult(pendingTestCase.generationResult.get());
+                specClient_->validateTestCaseOutput(pendingTestCase.inputFilename, pendingTestCase.outputFilename);
+            }
+        } catch (runtime_error& e) {
+            logger_->logTestCaseFailedResult(testCase.description());
+            logger_->logError(&e);
+            return optional<uint64_t>();
+        }
+
+        logger_->logTestCaseSuccessfulResult();
+        return optional<uint64_t>(pendingTestCase.inputHash);
+    }
+
+    void finishAll(
+            deque<PendingTestCase>& pendingTestCases,
+            const GenerationOptions& options,
+            vector<optional<uint64_t>>& results) {
+
+        for (PendingTestCase& pendingTestCase : pendingTestCases) {
+            results[pendingTestCase.index] = finish(pendingTestCase, options);
+        }
+        pendingTestCases.clear();
+    }
+
+    // The input is written in the background; it must be fully written before anything reads it.
+    uint64_t generateInput(const TestCase& testCase, const string& inputFilename) {
         specClient_->generateTestCaseInput(testCase.name(), inputFilename);
+        return specClient_->waitForTestCaseInput(inputFilename);
     }
 
     void generateOutput(
@@ -68,11 +191,16 @@ private:
             return;
         }
 
-        auto evaluationOptions = EvaluationOptionsBuilder()
+        checkGenerationResult(evaluator_->generate(inputFilename, outputFilename, createEvaluationOptions(options)));
+    }
+
+    static EvaluationOptions createEvaluationOptions(const GenerationOptions& options) {
+        return EvaluationOptionsBuilder()
                 .setSolutionCommand(options.solutionCommand())
                 .build();
+    }
 
-        GenerationResult generationResult = evaluator_->generate(inputFilename, outputFilename, evaluationOptions);
+    static void checkGenerationResult(const GenerationResult& generationResult) {
         if (!generationResult.executionResult().isSuccessful()) {
             throw ExecutionResults::asFormattedError({{"solution", generationResult.executionResult()}});
         }
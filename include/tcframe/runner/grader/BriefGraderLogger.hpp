@@ -25,6 +25,7 @@ public:
     void logError(runtime_error*) {}
     void logIntroduction(const string&) {}
     void logTestCaseVerdict(const Verdict&) {}
+    void logTestCaseDuplicateVerdict(const Verdict&, const string&) {}
 
     void logResult(const map<int, Verdict>& subtaskVerdicts, const Verdict& verdict) {
         engine_->logParagraph(0, verdict.toBriefString());
@@ -26,6 +26,10 @@ public:
         engine_->logParagraph(0, verdict.toString());
     }
 
+    void logTestCaseDuplicateVerdict(const Verdict& verdict, const string& originalTestCaseName) {
+        engine_->logParagraph(0, verdict.toString() + " (same input as " + originalTestCaseName + ")");
+    }
+
     void logResult(const map<int, Verdict>& subtaskVerdicts, const Verdict& verdict) {
         if (subtaskVerdicts.size() > 1) {
             engine_->logHeading("SUBTASK VERDICTS");
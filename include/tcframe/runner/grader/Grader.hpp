@@ -1,8 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GradingOptions.hpp"
@@ -15,38 +18,55 @@
 #include "tcframe/spec.hpp"
 #include "tcframe/util.hpp"
 
+using std::equal;
+using std::istream;
 using std::map;
+using std::make_pair;
 using std::max;
+using std::pair;
+using std::set;
+using std::streamsize;
 using std::string;
+using std::uint64_t;
 using std::vector;
 
 namespace tcframe {
 
 class Grader {
 private:
+    static const int CHUNK_SIZE = 1 << 16;
+
     SpecClient* specClient_;
     TestCaseGrader* testCaseGrader_;
     Aggregator* aggregator_;
+    OperatingSystem* os_;
     GraderLogger* logger_;
 
 public:
     virtual ~Grader() = default;
 
-    Grader(SpecClient* specClient, TestCaseGrader* testCaseGrader, Aggregator* aggregator, GraderLogger* logger)
+    Grader(
+            SpecClient* specClient,
+            TestCaseGrader* testCaseGrader,
+            Aggregator* aggregator,
+            OperatingSystem* os,
+            GraderLogger* logger)
             : specClient_(specClient)
             , testCaseGrader_(testCaseGrader)
             , aggregator_(aggregator)
+            , os_(os)
             , logger_(logger) {}
 
     virtual void grade(const GradingOptions& options) {
         logger_->logIntroduction(options.solutionCommand());
 
-        TestSuite testSuite = specClient_->getTestSuite();
+        const TestSuite& testSuite = specClient_->getTestSuite();
         bool hasMultipleTestCases = specClient_->hasMultipleTestCases();
 
         map<int, vector<Verdict>> verdictsBySubtaskId;
+        map<pair<uint64_t, set<int>>, pair<string, Verdict>> gradedInputs;
         for (const TestGroup& testGroup : testSuite.testGroups()) {
-            gradeTestGroup(testGroup, options, hasMultipleTestCases, verdictsBySubtaskId);
+            gradeTestGroup(testGroup, options, hasMultipleTestCases, verdictsBySubtaskId, gradedInputs);
         }
 
         map<int, double> subtaskPointsById = getSubtaskPoints(options);
@@ -85,7 +105,8 @@ private:
             const TestGroup& testGroup,
             const GradingOptions& options,
             bool hasMultipleTestCases,
-            map<int, vector<Verdict>>& verdictsBySubtaskId) {
+            map<int, vector<Verdict>>& verdictsBySubtaskId,
+            map<pair<uint64_t, set<int>>, pair<string, Verdict>>& gradedInputs) {
 
         if (hasMultipleTestCases && testGroup.testCases().empty()) {
             return;
@@ -96,27 +117,77 @@ private:
         if (hasMultipleTestCases) {
             auto testCase = TestCaseBuilder()
                     .setName(TestGroup::createName(options.slug(), testGroup.id()))
-                    .setSubtaskIds(testGroup.testCases()[0].subtaskIds())
+                    .setSharedSubtaskIds(testGroup.testCases()[0].sharedSubtaskIds())
                     .build();
-            gradeTestCase(testCase, options, verdictsBySubtaskId);
+            gradeTestCase(testCase, options, verdictsBySubtaskId, gradedInputs);
         } else {
             for (const TestCase& testCase : testGroup.testCases()) {
-                gradeTestCase(testCase, options, verdictsBySubtaskId);
+                gradeTestCase(testCase, options, verdictsBySubtaskId, gradedInputs);
             }
         }
     }
 
+    // When collapsing duplicates, a test case whose input is identical to an already graded test case
+    // with the same subtasks reuses its verdict instead of being evaluated again. The inputs are found by
+    // their hashes, and then compared byte for byte.
     void gradeTestCase(
             const TestCase& testCase,
             const GradingOptions& options,
-            map<int, vector<Verdict>>& verdictsBySubtaskId) {
+            map<int, vector<Verdict>>& verdictsBySubtaskId,
+            map<pair<uint64_t, set<int>>, pair<string, Verdict>>& gradedInputs) {
+
+        Verdict verdict;
+        if (options.collapseDuplicates()) {
+            pair<uint64_t, set<int>> key = {hashInput(testCase, options), testCase.subtaskIds()};
+            auto gradedInput = gradedInputs.find(key);
+            if (gradedInput != gradedInputs.end() && haveSameInput(testCase.name(), gradedInput->second.first, options)) {
+                verdict = gradedInput->second.second;
+                logger_->logTestCaseIntroduction(testCase.name());
+                logger_->logTestCaseDuplicateVerdict(verdict, gradedInput->second.first);
+            } else {
+                verdict = testCaseGrader_->grade(testCase, options);
+                gradedInputs.emplace(key, make_pair(testCase.name(), verdict));
+            }
+        } else {
+            verdict = testCaseGrader_->grade(testCase, options);
+        }
 
-        Verdict verdict = testCaseGrader_->grade(testCase, options);
         for (int subtaskId : testCase.subtaskIds()) {
             verdictsBySubtaskId[subtaskId].push_back(verdict);
         }
     }
 
+    uint64_t hashInput(const TestCase& testCase, const GradingOptions& options) {
+        istream* in = os_->openForReading(TestCasePathCreator::createInputPath(testCase.name(), options.outputDir()));
+        uint64_t hash = ContentHasher::hash(in);
+        os_->closeOpenedStream(in);
+        return hash;
+    }
+
+    bool haveSameInput(const string& testCaseName1, const string& testCaseName2, const GradingOptions& options) {
+        istream* in1 = os_->openForMappedReading(TestCasePathCreator::createInputPath(testCaseName1, options.outputDir()));
+        istream* in2 = os_->openForMappedReading(TestCasePathCreator::createInputPath(testCaseName2, options.outputDir()));
+        bool same = haveSameContent(in1, in2);
+        os_->closeOpenedStream(in1);
+        os_->closeOpenedStream(in2);
+        return same;
+    }
+
+    static bool haveSameContent(istream* in1, istream* in2) {
+        vector<char> buffer1(CHUNK_SIZE);
+        vector<char> buffer2(CHUNK_SIZE);
+        while (true) {
+            streamsize count1 = in1->rdbuf()->sgetn(buffer1.data(), CHUNK_SIZE);
+            streamsize count2 = in2->rdbuf()->sgetn(buffer2.data(), CHUNK_SIZE);
+            if (count1 != count2 || !equal(buffer1.begin(), buffer1.begin() + count1, buffer2.begin())) {
+                return false;
+            }
+            if (count1 == 0) {
+                return true;
+            }
+        }
+    }
+
     Verdict aggregate(const vector<Verdict>& subtaskVerdicts) {
         VerdictStatus aggregatedStatus = VerdictStatus::ac();
         double aggregatedPoints = 0;
@@ -136,8 +207,9 @@ public:
             SpecClient* specClient,
             TestCaseGrader* testCaseGrader,
             Aggregator* aggregator,
+            OperatingSystem* os,
             GraderLogger* logger) {
-        return new Grader(specClient, testCaseGrader, aggregator, logger);
+        return new Grader(specClient, testCaseGrader, aggregator, os, logger);
     }
 };
 
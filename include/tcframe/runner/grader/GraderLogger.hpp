@@ -16,6 +16,7 @@ public:
 
     virtual void logIntroduction(const string& solutionCommand) = 0;
     virtual void logTestCaseVerdict(const Verdict& verdict) = 0;
+    virtual void logTestCaseDuplicateVerdict(const Verdict& verdict, const string& originalTestCaseName) = 0;
     virtual void logResult(const map<int, Verdict>& subtaskVerdicts, const Verdict& verdict) = 0;
 };
 
@@ -22,6 +22,7 @@ private:
     vector<double> subtaskPoints_;
     string solutionCommand_;
     string outputDir_;
+    bool collapseDuplicates_ = false;
     optional<int> timeLimit_;
     optional<int> memoryLimit_;
 
@@ -42,6 +43,10 @@ public:
         return outputDir_;
     }
 
+    bool collapseDuplicates() const {
+        return collapseDuplicates_;
+    }
+
     const optional<int>& timeLimit() const {
         return timeLimit_;
     }
@@ -51,8 +56,9 @@ public:
     }
 
     bool operator==(const GradingOptions& o) const {
-        return tie(slug_, subtaskPoints_, solutionCommand_, outputDir_, timeLimit_, memoryLimit_) ==
-                tie(o.slug_, o.subtaskPoints_, o.solutionCommand_, o.outputDir_, o.timeLimit_, o.memoryLimit_);
+        return tie(slug_, subtaskPoints_, solutionCommand_, outputDir_, collapseDuplicates_, timeLimit_, memoryLimit_) ==
+                tie(o.slug_, o.subtaskPoints_, o.solutionCommand_, o.outputDir_, o.collapseDuplicates_, o.timeLimit_,
+                    o.memoryLimit_);
     }
 };
 
@@ -83,6 +89,11 @@ public:
         return *this;
     }
 
+    GradingOptionsBuilder& setCollapseDuplicates(bool collapseDuplicates) {
+        subject_.collapseDuplicates_ = collapseDuplicates;
+        return *this;
+    }
+
     GradingOptionsBuilder& setTimeLimit(int timeLimit) {
         subject_.timeLimit_ = optional<int>(timeLimit);
         return *this;
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "tcframe/runner/os/BackgroundWriter.hpp"
+#include "tcframe/runner/os/ContentHasher.hpp"
 #include "tcframe/runner/os/ExecutionResult.hpp"
 #include "tcframe/runner/os/ExecutionRequest.hpp"
+#include "tcframe/runner/os/MappedFileStream.hpp"
 #include "tcframe/runner/os/OperatingSystem.hpp"
 #include "tcframe/runner/os/TestCasePathCreator.hpp"
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#include "ContentHasher.hpp"
+#include "tcframe/util.hpp"
+
+using std::condition_variable;
+using std::deque;
+using std::map;
+using std::memcpy;
+using std::min;
+using std::mutex;
+using std::ostream;
+using std::runtime_error;
+using std::set;
+using std::streambuf;
+using std::streamsize;
+using std::string;
+using std::thread;
+using std::uint64_t;
+using std::unique_lock;
+
+namespace tcframe {
+
+/*
+ * Writes files on a background thread, so that the caller does not block on disk I/O. Files are handed
+ * over in chunks as they are produced, and at most a few chunks are queued at a time, so the memory used
+ * does not grow with the size of the files. Write errors and content hashes are kept per file, to be
+ * reported to whoever produced that file.
+ */
+class BackgroundWriter {
+public:
+    static const size_t CHUNK_SIZE = 1 << 20;
+    static const size_t MAX_QUEUED_CHUNKS = 2;
+
+private:
+    struct Chunk {
+        string filename;
+        string data;
+        bool isFirst;
+        bool isLast;
+    };
+
+    mutex mutex_;
+    condition_variable condition_;
+    thread thread_;
+
+    bool isStopping_ = false;
+    deque<Chunk> queue_;
+
+    // Number of chunks of each file that are queued or being written.
+    map<string, int> pendingChunkCounts_;
+    set<string> failedFilenames_;
+    map<string, uint64_t> contentHashes_;
+
+    // Only accessed by the writer thread; -1 for a file that could not be written.
+    map<string, int> fds_;
+
+public:
+    virtual ~BackgroundWriter() {
+        {
+            unique_lock<mutex> lock(mutex_);
+            isStopping_ = true;
+        }
+        condition_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // Queues the next chunk of the file, waiting first if too many chunks are already queued. The first
+    // chunk truncates the file, and the last one closes it and comes with the hash of the whole file.
+    virtual void write(const string& filename, string data, bool isFirst, bool isLast, uint64_t contentHash) {
+        unique_lock<mutex> lock(mutex_);
+        if (!thread_.joinable()) {
+            thread_ = thread(&BackgroundWriter::run, this);
+        }
+        condition_.wait(lock, [this] { return queue_.size() < MAX_QUEUED_CHUNKS; });
+        if (isFirst) {
+            failedFilenames_.erase(filename);
+            contentHashes_.erase(filename);
+        }
+        if (isLast) {
+            contentHashes_[filename] = contentHash;
+        }
+        pendingChunkCounts_[filename]++;
+        queue_.push_back({filename, std::move(data), isFirst, isLast});
+        condition_.notify_all();
+    }
+
+    // Waits until the file has been written. Errors are left for flush(filename) to report.
+    virtual void wait(const string& filename) {
+        unique_lock<mutex> lock(mutex_);
+        condition_.wait(lock, [&] { return !pendingChunkCounts_.count(filename); });
+    }
+
+    // Waits until the file has been written, and returns the hash of its content, or nothing if it was
+    // not written by this writer. Throws if it could not be written.
+    virtual optional<uint64_t> flush(const string& filename) {
+        unique_lock<mutex> lock(mutex_);
+        condition_.wait(lock, [&] { return !pendingChunkCounts_.count(filename); });
+        optional<uint64_t> contentHash;
+        auto entry = contentHashes_.find(filename);
+        if (entry != contentHashes_.end()) {
+            contentHash = optional<uint64_t>(entry->second);
+            contentHashes_.erase(entry);
+        }
+        if (failedFilenames_.erase(filename)) {
+            throw runtime_error("Cannot write " + filename);
+        }
+        return contentHash;
+    }
+
+    // Waits until all queued chunks have been written. Errors are left for flush(filename) to report.
+    virtual void flush() {
+        unique_lock<mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return pendingChunkCounts_.empty(); });
+    }
+
+private:
+    void run() {
+        unique_lock<mutex> lock(mutex_);
+        while (true) {
+            condition_.wait(lock, [this] { return !queue_.empty() || isStopping_; });
+            if (queue_.empty()) {
+                return;
+            }
+            Chunk chunk = std::move(queue_.front());
+            queue_.pop_front();
+            condition_.notify_all();
+
+            lock.unlock();
+            bool isWritten = writeChunk(chunk);
+            lock.lock();
+
+            if (!isWritten) {
+                failedFilenames_.insert(chunk.filename);
+            }
+            if (--pendingChunkCounts_[chunk.filename] == 0) {
+                pendingChunkCounts_.erase(chunk.filename);
+            }
+            condition_.notify_all();
+        }
+    }
+
+    bool writeChunk(const Chunk& chunk) {
+        if (chunk.isFirst) {
+            fds_[chunk.filename] = ::open(chunk.filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        }
+        int& fd = fds_[chunk.filename];
+        bool isWritten = fd >= 0 && writeAll(fd, chunk.data);
+        if (fd >= 0 && !isWritten) {
+            ::close(fd);
+            fd = -1;
+        }
+        if (chunk.isLast) {
+            if (fd >= 0 && ::close(fd) != 0) {
+                isWritten = false;
+            }
+            fds_.erase(chunk.filename);
+        }
+        return isWritten;
+    }
+
+    static bool writeAll(int fd, const string& data) {
+        const char* p = data.data();
+        size_t remaining = data.size();
+        while (remaining > 0) {
+            ssize_t count = ::write(fd, p, remaining);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            p += count;
+            remaining -= (size_t) count;
+        }
+        return true;
+    }
+};
+
+// Output stream buffer that hands whatever is written to a BackgroundWriter, one full chunk at a time,
+// hashing the chunks as they are handed over.
+class BackgroundWriterBuffer : public streambuf {
+private:
+    BackgroundWriter* writer_;
+    string filename_;
+    string chunk_;
+    ContentHasher hasher_;
+    bool isFirst_ = true;
+    bool isClosed_ = false;
+
+public:
+    virtual ~BackgroundWriterBuffer() = default;
+
+    BackgroundWriterBuffer(BackgroundWriter* writer, string filename)
+            : writer_(writer)
+            , filename_(std::move(filename))
+            , chunk_(BackgroundWriter::CHUNK_SIZE, '\0') {
+        resetChunk();
+    }
+
+    const string& filename() const {
+        return filename_;
+    }
+
+    // Hands the rest of the file to the writer. Nothing may be written afterwards.
+    void close() {
+        if (!isClosed_) {
+            submitChunk(true);
+            isClosed_ = true;
+        }
+    }
+
+protected:
+    int_type overflow(int_type c) {
+        if (pptr() == epptr()) {
+            submitChunk(false);
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    streamsize xsputn(const char* s, streamsize n) {
+        streamsize written = 0;
+        while (written < n) {
+            if (pptr() == epptr()) {
+                submitChunk(false);
+            }
+            size_t count = (size_t) min((streamsize) (epptr() - pptr()), n - written);
+            memcpy(pptr(), s + written, count);
+            pbump((int) count);
+            written += (streamsize) count;
+        }
+        return n;
+    }
+
+private:
+    void submitChunk(bool isLast) {
+        hasher_.update(pbase(), (size_t) (pptr() - pbase()));
+        writer_->write(filename_, string(pbase(), pptr()), isFirst_, isLast, isLast ? hasher_.digest() : 0);
+        isFirst_ = false;
+        resetChunk();
+    }
+
+    void resetChunk() {
+        setp(&chunk_[0], &chunk_[0] + chunk_.size());
+    }
+};
+
+// Stream for a file that is written by a BackgroundWriter while it is being produced.
+class BackgroundWriterStream : public ostream {
+private:
+    BackgroundWriterBuffer buffer_;
+
+public:
+    virtual ~BackgroundWriterStream() = default;
+
+    BackgroundWriterStream(BackgroundWriter* writer, string filename)
+            : ostream(nullptr)
+            , buffer_(writer, std::move(filename)) {
+        init(&buffer_);
+    }
+
+    const string& filename() const {
+        return buffer_.filename();
+    }
+
+    void close() {
+        buffer_.close();
+    }
+};
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <vector>
+
+using std::istream;
+using std::memcpy;
+using std::streamsize;
+using std::uint64_t;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * A fast 64-bit non-cryptographic hash of the whole content of a file, used to find test cases
+ * with identical files. The content may be given in pieces of any size, as it is produced; the
+ * result does not depend on how it happens to be chunked.
+ */
+class ContentHasher {
+private:
+    static const int CHUNK_SIZE = 1 << 16;
+
+    uint64_t h_ = 0x9e3779b97f4a7c15ULL;
+    uint64_t length_ = 0;
+
+    // The bytes that do not fill a whole word yet.
+    char pending_[8];
+    size_t pendingCount_ = 0;
+
+public:
+    static uint64_t hash(istream* in) {
+        vector<char> buffer(CHUNK_SIZE);
+        ContentHasher hasher;
+        streamsize count;
+        while ((count = in->rdbuf()->sgetn(buffer.data(), CHUNK_SIZE)) > 0) {
+            hasher.update(buffer.data(), (size_t) count);
+        }
+        return hasher.digest();
+    }
+
+    void update(const char* data, size_t size) {
+        length_ += size;
+        if (pendingCount_ > 0) {
+            size_t count = size < 8 - pendingCount_ ? size : 8 - pendingCount_;
+            memcpy(pending_ + pendingCount_, data, count);
+            pendingCount_ += count;
+            data += count;
+            size -= count;
+            if (pendingCount_ < 8) {
+                return;
+            }
+            addWord(pending_);
+            pendingCount_ = 0;
+        }
+        for (; size >= 8; data += 8, size -= 8) {
+            addWord(data);
+        }
+        memcpy(pending_, data, size);
+        pendingCount_ = size;
+    }
+
+    // Returns the hash of everything given so far.
+    uint64_t digest() const {
+        uint64_t h = h_;
+        if (pendingCount_ > 0) {
+            uint64_t word = 0;
+            memcpy(&word, pending_, pendingCount_);
+            h = mix(h ^ word);
+        }
+        return finalize(h ^ length_);
+    }
+
+private:
+    void addWord(const char* data) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        h_ = mix(h_ ^ word);
+    }
+
+    static uint64_t mix(uint64_t h) {
+        h *= 0xff51afd7ed558ccdULL;
+        return h ^ (h >> 32);
+    }
+
+    static uint64_t finalize(uint64_t h) {
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+};
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <fcntl.h>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tcframe/util/MemoryBuffer.hpp"
+
+using std::istream;
+using std::string;
+
+namespace tcframe {
+
+// Read-only stream buffer over a memory-mapped file. The whole file is exposed as the get area.
+class MappedFileBuffer : public MemoryBuffer {
+private:
+    char* data_ = nullptr;
+    size_t size_ = 0;
+    bool isOpen_ = false;
+
+public:
+    virtual ~MappedFileBuffer() {
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+    }
+
+    explicit MappedFileBuffer(const string& filename) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            close(fd);
+            return;
+        }
+
+        size_ = (size_t) st.st_size;
+        if (size_ > 0) {
+            void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                return;
+            }
+            data_ = (char*) data;
+            madvise(data_, size_, MADV_SEQUENTIAL);
+        }
+        close(fd);
+
+        setRange(data_, data_ + size_);
+        isOpen_ = true;
+    }
+
+    bool isOpen() const {
+        return isOpen_;
+    }
+};
+
+class MappedFileStream : public istream {
+private:
+    MappedFileBuffer buffer_;
+
+public:
+    virtual ~MappedFileStream() = default;
+
+    explicit MappedFileStream(const string& filename)
+            : istream(nullptr)
+            , buffer_(filename) {
+        init(&buffer_);
+    }
+
+    bool isOpen() const {
+        return buffer_.isOpen();
+    }
+};
+
+}
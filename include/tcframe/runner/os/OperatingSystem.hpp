@@ -1,59 +1,117 @@
 #pragma once
 
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <sys/wait.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
 
+#include "BackgroundWriter.hpp"
 #include "ExecutionRequest.hpp"
 #include "ExecutionResult.hpp"
+#include "MappedFileStream.hpp"
 #include "tcframe/util.hpp"
 
+using std::atomic;
 using std::ifstream;
 using std::ios;
 using std::istream;
 using std::ofstream;
 using std::ostream;
 using std::ostringstream;
+using std::pair;
+using std::remove;
+using std::runtime_error;
 using std::string;
+using std::uint64_t;
+using std::vector;
 
 namespace tcframe {
 
 class OperatingSystem {
 private:
-    static constexpr const char* ERROR_FILENAME = "__tcframe_error.out";
+    static constexpr const char* ERROR_FILENAME_PREFIX = "__tcframe_error_";
+
+    // Each execution has its own standard error file, so that executions may run concurrently.
+    atomic<int> executionCount_{0};
+
+    // Every other operation on a file first waits for its background write, if any, so that it sees the
+    // whole file. Write errors are only reported by waitForBackgroundWriting(), to the producer of the file.
+    BackgroundWriter backgroundWriter_;
 
 public:
     virtual ~OperatingSystem() = default;
 
     virtual istream* openForReading(const string& filename) {
+        backgroundWriter_.wait(filename);
         ifstream* file = new ifstream();
         file->open(filename);
         return file;
     }
 
+    virtual istream* openForMappedReading(const string& filename) {
+        backgroundWriter_.wait(filename);
+        MappedFileStream* file = new MappedFileStream(filename);
+        if (!file->isOpen()) {
+            delete file;
+            return openForReading(filename);
+        }
+        return file;
+    }
+
     virtual ostream* openForWriting(const string& filename) {
+        backgroundWriter_.wait(filename);
         ofstream* file = new ofstream();
         file->open(filename);
         return file;
     }
 
+    // The file is written in the background, in chunks, while it is being produced.
+    virtual ostream* openForBackgroundWriting(const string& filename) {
+        return new BackgroundWriterStream(&backgroundWriter_, filename);
+    }
+
+    // Waits until a file opened by openForBackgroundWriting() and then closed has been written, and returns
+    // the hash of its content (see ContentHasher), or nothing if it was not written in the background.
+    // Throws if it could not be written.
+    virtual optional<uint64_t> waitForBackgroundWriting(const string& filename) {
+        return backgroundWriter_.flush(filename);
+    }
+
     virtual void closeOpenedStream(ios* stream) {
+        auto backgroundWriterStream = dynamic_cast<BackgroundWriterStream*>(stream);
+        if (backgroundWriterStream != nullptr) {
+            backgroundWriterStream->close();
+        }
         delete stream;
     }
 
     virtual void forceMakeDir(const string& dirName) {
+        backgroundWriter_.flush();
         runCommand("rm -rf " + dirName);
         runCommand("mkdir -p " + dirName);
     }
 
     virtual void removeFile(const string& filename) {
+        backgroundWriter_.wait(filename);
         runCommand("rm -rf " + filename);
     }
 
     virtual ExecutionResult execute(const ExecutionRequest& request) {
+        if (request.inputFilename()) {
+            backgroundWriter_.wait(request.inputFilename().value());
+        }
+        string errorFilename = ERROR_FILENAME_PREFIX + StringUtils::toString(executionCount_++) + ".out";
         ostringstream sout;
 
         sout << "{ ";
@@ -77,7 +135,7 @@ public:
         } else {
             sout << " 1> /dev/null";
         }
-        sout << " 2> " << ERROR_FILENAME;
+        sout << " 2> " << errorFilename;
 
         ExecutionResultBuilder result;
 
@@ -90,14 +148,69 @@ public:
             result.setExitCode(exitStatus);
         }
 
-        istream* errorStream = openForReading(ERROR_FILENAME);
+        istream* errorStream = openForReading(errorFilename);
         string errorString = StringUtils::streamToString(errorStream);
         closeOpenedStream(errorStream);
+        remove(errorFilename.c_str());
         result.setStandardError(errorString);
 
         return result.build();
     }
 
+    // Starts the program, found as execvp() does, with its standard input and output connected to the
+    // returned streams: (from its standard output, to its standard input). The program should exit once
+    // its standard input is closed.
+    virtual pair<FILE*, FILE*> startProcess(const string& program, const vector<string>& arguments) {
+        int toProcess[2];
+        int fromProcess[2];
+        if (pipe(toProcess) != 0 || pipe(fromProcess) != 0) {
+            throw runtime_error("Cannot start " + program);
+        }
+
+        // Writing to the process after it has died should fail, instead of killing the runner.
+        signal(SIGPIPE, SIG_IGN);
+
+        // Built before forking, as the child may only make async-signal-safe calls until exec.
+        vector<char*> argv;
+        argv.push_back((char*) program.c_str());
+        for (const string& argument : arguments) {
+            argv.push_back((char*) argument.c_str());
+        }
+        argv.push_back(nullptr);
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            throw runtime_error("Cannot start " + program);
+        }
+        if (pid == 0) {
+            dup2(toProcess[0], STDIN_FILENO);
+            dup2(fromProcess[1], STDOUT_FILENO);
+            close(toProcess[0]);
+            close(toProcess[1]);
+            close(fromProcess[0]);
+            close(fromProcess[1]);
+            execvp(program.c_str(), argv.data());
+            _exit(127);
+        }
+
+        close(toProcess[0]);
+        close(fromProcess[1]);
+
+        // So that the pipes are not held open by the processes executed later.
+        fcntl(toProcess[1], F_SETFD, FD_CLOEXEC);
+        fcntl(fromProcess[0], F_SETFD, FD_CLOEXEC);
+        return {fdopen(fromProcess[0], "r"), fdopen(toProcess[1], "w")};
+    }
+
+    // Returns streams for this process's original standard input and output, as (input, output), and
+    // sends anything written to the standard output from now on to the standard error instead.
+    virtual pair<FILE*, FILE*> takeStandardStreams() {
+        fflush(stdout);
+        FILE* out = fdopen(dup(STDOUT_FILENO), "w");
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+        return {stdin, out};
+    }
+
 private:
     static void runCommand(const string& command) {
         system(command.c_str());
@@ -1,23 +1,64 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "tcframe/util.hpp"
 
+using std::function;
 using std::move;
 using std::string;
 using std::tie;
+using std::vector;
 
 namespace tcframe {
 
+enum class AggregateType {
+    SUM,
+    MAX,
+    COUNT
+};
+
+// A quantity accumulated over the test cases of a test group, for use in MultipleTestCasesConstraints().
+struct MultipleTestCasesAggregate {
+private:
+    AggregateType type_;
+    long long* var_;
+    function<long long()> quantity_;
+
+public:
+    MultipleTestCasesAggregate(AggregateType type, long long* var, function<long long()> quantity)
+            : type_(type)
+            , var_(var)
+            , quantity_(move(quantity)) {}
+
+    AggregateType type() const {
+        return type_;
+    }
+
+    long long* var() const {
+        return var_;
+    }
+
+    const function<long long()>& quantity() const {
+        return quantity_;
+    }
+
+    bool operator==(const MultipleTestCasesAggregate& o) const {
+        return tie(type_, var_) == tie(o.type_, o.var_);
+    }
+};
+
 struct MultipleTestCasesConfig {
     friend class MultipleTestCasesConfigBuilder;
 
 private:
     optional<int*> counter_;
     optional<string> outputPrefix_;
+    vector<MultipleTestCasesAggregate> aggregates_;
 
 public:
     const optional<int*>& counter() const {
@@ -28,8 +69,12 @@ public:
         return outputPrefix_;
     }
 
+    const vector<MultipleTestCasesAggregate>& aggregates() const {
+        return aggregates_;
+    }
+
     bool operator==(const MultipleTestCasesConfig& o) const {
-        return tie(counter_, outputPrefix_) == tie(o.counter_, o.outputPrefix_);
+        return tie(counter_, outputPrefix_, aggregates_) == tie(o.counter_, o.outputPrefix_, o.aggregates_);
     }
 };
 
@@ -48,6 +93,24 @@ public:
         return *this;
     }
 
+    // Sets var to the sum of quantity() over the test cases of a test group.
+    MultipleTestCasesConfigBuilder& Sum(long long& var, function<long long()> quantity) {
+        subject_.aggregates_.emplace_back(AggregateType::SUM, &var, move(quantity));
+        return *this;
+    }
+
+    // Sets var to the maximum of quantity() over the test cases of a test group.
+    MultipleTestCasesConfigBuilder& Max(long long& var, function<long long()> quantity) {
+        subject_.aggregates_.emplace_back(AggregateType::MAX, &var, move(quantity));
+        return *this;
+    }
+
+    // Sets var to the number of test cases of a test group for which predicate() holds.
+    MultipleTestCasesConfigBuilder& Count(long long& var, function<bool()> predicate) {
+        subject_.aggregates_.emplace_back(AggregateType::COUNT, &var, [=] {return predicate() ? 1LL : 0LL;});
+        return *this;
+    }
+
     MultipleTestCasesConfig build() {
         return move(subject_);
     }
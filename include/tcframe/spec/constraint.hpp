@@ -1,5 +1,8 @@
 #pragma once
 
 #include "tcframe/spec/constraint/Constraint.hpp"
+#include "tcframe/spec/constraint/ConstraintResult.hpp"
 #include "tcframe/spec/constraint/ConstraintSuite.hpp"
+#include "tcframe/spec/constraint/GraphConstraints.hpp"
 #include "tcframe/spec/constraint/Subtask.hpp"
+#include "tcframe/spec/constraint/VectorConstraints.hpp"
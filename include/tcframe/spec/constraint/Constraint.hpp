@@ -5,6 +5,8 @@
 #include <tuple>
 #include <utility>
 
+#include "ConstraintResult.hpp"
+
 using std::function;
 using std::move;
 using std::string;
@@ -14,15 +16,15 @@ namespace tcframe {
 
 struct Constraint {
 private:
-    function<bool()> predicate_;
+    function<ConstraintResult()> predicate_;
     string description_;
 
 public:
-    Constraint(function<bool()> predicate, string description)
+    Constraint(function<ConstraintResult()> predicate, string description)
             : predicate_(move(predicate))
             , description_(move(description)) {}
 
-    const function<bool()>& predicate() const {
+    const function<ConstraintResult()>& predicate() const {
         return predicate_;
     }
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <utility>
+
+using std::move;
+using std::string;
+using std::tie;
+
+namespace tcframe {
+
+/*
+ * Outcome of evaluating a constraint. A predicate may simply return a bool; the built-in constraint
+ * helpers return a violation with a reason (e.g. the first offending index) instead.
+ */
+struct ConstraintResult {
+private:
+    bool isSatisfied_;
+    string reason_;
+
+public:
+    ConstraintResult(bool isSatisfied = true)
+            : isSatisfied_(isSatisfied) {}
+
+    static ConstraintResult violated(string reason) {
+        ConstraintResult result(false);
+        result.reason_ = move(reason);
+        return result;
+    }
+
+    bool isSatisfied() const {
+        return isSatisfied_;
+    }
+
+    const string& reason() const {
+        return reason_;
+    }
+
+    explicit operator bool() const {
+        return isSatisfied_;
+    }
+
+    // The description of an unsatisfied constraint, followed by the reason if there is one.
+    string describe(const string& description) const {
+        if (reason_.empty()) {
+            return description;
+        }
+        return description + " (" + reason_ + ")";
+    }
+
+    bool operator==(const ConstraintResult& o) const {
+        return tie(isSatisfied_, reason_) == tie(o.isSatisfied_, o.reason_);
+    }
+};
+
+}
@@ -94,7 +94,7 @@ public:
         return *this;
     }
 
-    ConstraintSuiteBuilder& addConstraint(function<bool()> predicate, string description) {
+    ConstraintSuiteBuilder& addConstraint(function<ConstraintResult()> predicate, string description) {
         if (isInMultipleTestCasesConstraints_) {
             subject_.multipleTestCasesConstraints_.emplace_back(predicate, description);
         } else {
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ConstraintResult.hpp"
+#include "tcframe/util.hpp"
+
+using std::size_t;
+using std::string;
+using std::swap;
+using std::unordered_set;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Graph constraint helpers, to be used in CONS() on a graph with vertices firstVertex, ...,
+ * firstVertex + n - 1, given as edge lists: the i-th edge connects U[i] and V[i]. All of them run in
+ * near-linear time; when violated, the reason names the offending edge or vertex.
+ */
+class GraphConstraints {
+public:
+    // No self-loops and no two edges connecting the same pair of vertices (in either direction).
+    template<typename T>
+    static ConstraintResult isSimpleGraph(int n, const vector<T>& U, const vector<T>& V, int firstVertex = 1) {
+        ConstraintResult result = checkEdges(n, U, V, firstVertex);
+        if (!result) {
+            return result;
+        }
+
+        unordered_set<long long> edges;
+        edges.reserve(U.size());
+        for (size_t i = 0; i < U.size(); i++) {
+            long long u = (long long) U[i] - firstVertex;
+            long long v = (long long) V[i] - firstVertex;
+            if (u == v) {
+                return ConstraintResult::violated(edge(i, U[i], V[i]) + " is a self-loop");
+            }
+            if (u > v) {
+                swap(u, v);
+            }
+            if (!edges.insert(u * n + v).second) {
+                return ConstraintResult::violated(edge(i, U[i], V[i]) + " is a multi-edge");
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    static ConstraintResult isConnected(int n, const vector<T>& U, const vector<T>& V, int firstVertex = 1) {
+        ConstraintResult result = checkEdges(n, U, V, firstVertex);
+        if (!result) {
+            return result;
+        }
+
+        DisjointSet components(n);
+        for (size_t i = 0; i < U.size(); i++) {
+            components.merge((int) (U[i] - firstVertex), (int) (V[i] - firstVertex));
+        }
+        for (int x = 1; x < n; x++) {
+            if (components.find(x) != components.find(0)) {
+                return ConstraintResult::violated(
+                        "vertex " + StringUtils::toString(x + firstVertex) + " is not reachable from vertex "
+                        + StringUtils::toString(firstVertex));
+            }
+        }
+        return true;
+    }
+
+    // Undirected and acyclic.
+    template<typename T>
+    static ConstraintResult isForest(int n, const vector<T>& U, const vector<T>& V, int firstVertex = 1) {
+        ConstraintResult result = checkEdges(n, U, V, firstVertex);
+        if (!result) {
+            return result;
+        }
+
+        DisjointSet components(n);
+        for (size_t i = 0; i < U.size(); i++) {
+            if (!components.merge((int) (U[i] - firstVertex), (int) (V[i] - firstVertex))) {
+                return ConstraintResult::violated(edge(i, U[i], V[i]) + " forms a cycle");
+            }
+        }
+        return true;
+    }
+
+    // Undirected, connected, and acyclic.
+    template<typename T>
+    static ConstraintResult isTree(int n, const vector<T>& U, const vector<T>& V, int firstVertex = 1) {
+        if (U.size() + 1 != (size_t) n) {
+            return ConstraintResult::violated(
+                    "has " + StringUtils::toString(U.size()) + " edges instead of " + StringUtils::toString(n - 1));
+        }
+        return isForest(n, U, V, firstVertex);
+    }
+
+    // Directed from U[i] to V[i], and acyclic.
+    template<typename T>
+    static ConstraintResult isDAG(int n, const vector<T>& U, const vector<T>& V, int firstVertex = 1) {
+        ConstraintResult result = checkEdges(n, U, V, firstVertex);
+        if (!result) {
+            return result;
+        }
+
+        // Kahn's algorithm over a compressed adjacency list.
+        vector<int> inDegrees(n, 0);
+        vector<int> adjacencyBegin(n + 1, 0);
+        for (size_t i = 0; i < U.size(); i++) {
+            adjacencyBegin[U[i] - firstVertex + 1]++;
+            inDegrees[V[i] - firstVertex]++;
+        }
+        for (int x = 0; x < n; x++) {
+            adjacencyBegin[x + 1] += adjacencyBegin[x];
+        }
+        vector<int> adjacency(U.size());
+        vector<int> adjacencyEnd(adjacencyBegin.begin(), adjacencyBegin.end() - 1);
+        for (size_t i = 0; i < U.size(); i++) {
+            adjacency[adjacencyEnd[U[i] - firstVertex]++] = (int) (V[i] - firstVertex);
+        }
+
+        vector<int> queue;
+        queue.reserve(n);
+        for (int x = 0; x < n; x++) {
+            if (inDegrees[x] == 0) {
+                queue.push_back(x);
+            }
+        }
+        for (size_t head = 0; head < queue.size(); head++) {
+            int x = queue[head];
+            for (int j = adjacencyBegin[x]; j < adjacencyBegin[x + 1]; j++) {
+                if (--inDegrees[adjacency[j]] == 0) {
+                    queue.push_back(adjacency[j]);
+                }
+            }
+        }
+        for (int x = 0; x < n; x++) {
+            if (inDegrees[x] > 0) {
+                return ConstraintResult::violated(
+                        "vertex " + StringUtils::toString(x + firstVertex) + " is on or reachable from a cycle");
+            }
+        }
+        return true;
+    }
+
+private:
+    // Union-find with path halving and union by size.
+    class DisjointSet {
+    private:
+        vector<int> parents_;
+        vector<int> sizes_;
+
+    public:
+        explicit DisjointSet(int n)
+                : parents_(n)
+                , sizes_(n, 1) {
+            for (int x = 0; x < n; x++) {
+                parents_[x] = x;
+            }
+        }
+
+        int find(int x) {
+            while (parents_[x] != x) {
+                parents_[x] = parents_[parents_[x]];
+                x = parents_[x];
+            }
+            return x;
+        }
+
+        // Returns false if x and y are already in the same set.
+        bool merge(int x, int y) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return false;
+            }
+            if (sizes_[x] < sizes_[y]) {
+                swap(x, y);
+            }
+            parents_[y] = x;
+            sizes_[x] += sizes_[y];
+            return true;
+        }
+    };
+
+    template<typename T>
+    static string edge(size_t i, const T& u, const T& v) {
+        return "edge [" + StringUtils::toString(i) + "] (" + StringUtils::toString(u) + ", "
+               + StringUtils::toString(v) + ")";
+    }
+
+    template<typename T>
+    static ConstraintResult checkEdges(int n, const vector<T>& U, const vector<T>& V, int firstVertex) {
+        if (U.size() != V.size()) {
+            return ConstraintResult::violated("the edge lists have different sizes");
+        }
+        for (size_t i = 0; i < U.size(); i++) {
+            if (!(firstVertex <= U[i] && U[i] < firstVertex + n && firstVertex <= V[i] && V[i] < firstVertex + n)) {
+                return ConstraintResult::violated(edge(i, U[i], V[i]) + " has a vertex out of range");
+            }
+        }
+        return true;
+    }
+};
+
+}
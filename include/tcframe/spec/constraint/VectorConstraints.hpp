@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ConstraintResult.hpp"
+#include "tcframe/util.hpp"
+
+using std::min;
+using std::size_t;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Element-wise constraint helpers, to be used in CONS() on vectors and matrices. When violated, the
+ * reason names the first offending index. Range and order checks scan in blocks without branching
+ * on each element, so that the compiler can vectorize them, and only rescan the failing block.
+ */
+class VectorConstraints {
+public:
+    static const int BLOCK_SIZE = 1 << 10;
+
+    // The bounds may have different types, e.g. eachElementBetween(A, 1, 1e9).
+    template<typename T, typename L, typename H>
+    static ConstraintResult eachElementBetween(const vector<T>& v, const L& lo, const H& hi) {
+        size_t i = findNotBetween(v, lo, hi);
+        if (i != v.size()) {
+            return notBetween(index(i), v[i], lo, hi);
+        }
+        return true;
+    }
+
+    template<typename T, typename L, typename H>
+    static ConstraintResult eachElementBetween(const vector<vector<T>>& m, const L& lo, const H& hi) {
+        for (size_t r = 0; r < m.size(); r++) {
+            size_t c = findNotBetween(m[r], lo, hi);
+            if (c != m[r].size()) {
+                return notBetween(index(r) + index(c), m[r][c], lo, hi);
+            }
+        }
+        return true;
+    }
+
+    // Non-decreasing order.
+    template<typename T>
+    static ConstraintResult isSorted(const vector<T>& v) {
+        return checkOrder(v, false);
+    }
+
+    // Strictly increasing order.
+    template<typename T>
+    static ConstraintResult isStrictlySorted(const vector<T>& v) {
+        return checkOrder(v, true);
+    }
+
+    template<typename T>
+    static ConstraintResult isDistinct(const vector<T>& v) {
+        unordered_map<T, size_t> firstIndices;
+        firstIndices.reserve(v.size());
+        for (size_t i = 0; i < v.size(); i++) {
+            auto inserted = firstIndices.emplace(v[i], i);
+            if (!inserted.second) {
+                return ConstraintResult::violated(
+                        "at " + index(i) + ": " + StringUtils::toString(v[i])
+                        + " already appears at " + index(inserted.first->second));
+            }
+        }
+        return true;
+    }
+
+    // Contains each of 1, 2, ..., size exactly once.
+    template<typename T>
+    static ConstraintResult isPermutation(const vector<T>& v) {
+        vector<size_t> firstIndices(v.size() + 1, v.size());
+        for (size_t i = 0; i < v.size(); i++) {
+            if (!(1 <= (long long) v[i] && (long long) v[i] <= (long long) v.size())) {
+                return ConstraintResult::violated(
+                        "at " + index(i) + ": " + StringUtils::toString(v[i])
+                        + " is not between 1 and " + StringUtils::toString(v.size()));
+            }
+            size_t& firstIndex = firstIndices[(size_t) v[i]];
+            if (firstIndex != v.size()) {
+                return ConstraintResult::violated(
+                        "at " + index(i) + ": " + StringUtils::toString(v[i])
+                        + " already appears at " + index(firstIndex));
+            }
+            firstIndex = i;
+        }
+        return true;
+    }
+
+    template<typename T>
+    static ConstraintResult sumBetween(const vector<T>& v, long long lo, long long hi) {
+        long long sum = 0;
+        bool isOverflow = false;
+        for (size_t i = 0; i < v.size(); i++) {
+            isOverflow |= __builtin_add_overflow(sum, (long long) v[i], &sum);
+        }
+        if (isOverflow) {
+            return ConstraintResult::violated("sum overflows long long");
+        }
+        if (!(lo <= sum && sum <= hi)) {
+            return ConstraintResult::violated(
+                    "sum is " + StringUtils::toString(sum) + ", not between "
+                    + StringUtils::toString(lo) + " and " + StringUtils::toString(hi));
+        }
+        return true;
+    }
+
+    // For non-negative elements. The product of no elements is 1.
+    template<typename T>
+    static ConstraintResult productAtMost(const vector<T>& v, long long limit) {
+        bool hasZero = false;
+        for (size_t i = 0; i < v.size(); i++) {
+            if (v[i] < 0) {
+                return ConstraintResult::violated(
+                        "at " + index(i) + ": " + StringUtils::toString(v[i]) + " is negative");
+            }
+            hasZero |= v[i] == 0;
+        }
+
+        long long product = hasZero ? 0 : 1;
+        for (size_t i = 0; i < v.size() && !hasZero; i++) {
+            if (__builtin_mul_overflow(product, (long long) v[i], &product) || product > limit) {
+                return ConstraintResult::violated(
+                        "product exceeds " + StringUtils::toString(limit) + " at " + index(i));
+            }
+        }
+        if (product > limit) {
+            return ConstraintResult::violated(
+                    "product is " + StringUtils::toString(product) + ", which exceeds " + StringUtils::toString(limit));
+        }
+        return true;
+    }
+
+private:
+    static string index(size_t i) {
+        return "[" + StringUtils::toString(i) + "]";
+    }
+
+    template<typename T, typename L, typename H>
+    static size_t findNotBetween(const vector<T>& v, const L& lo, const H& hi) {
+        for (size_t begin = 0; begin < v.size(); begin += BLOCK_SIZE) {
+            size_t end = min(v.size(), begin + BLOCK_SIZE);
+            bool isValid = true;
+            for (size_t i = begin; i < end; i++) {
+                isValid &= (lo <= v[i]) & (v[i] <= hi);
+            }
+            if (!isValid) {
+                for (size_t i = begin; i < end; i++) {
+                    if (!(lo <= v[i] && v[i] <= hi)) {
+                        return i;
+                    }
+                }
+            }
+        }
+        return v.size();
+    }
+
+    template<typename T, typename L, typename H>
+    static ConstraintResult notBetween(const string& at, const T& value, const L& lo, const H& hi) {
+        return ConstraintResult::violated(
+                "at " + at + ": " + StringUtils::toString(value) + " is not between "
+                + StringUtils::toString(lo) + " and " + StringUtils::toString(hi));
+    }
+
+    template<typename T>
+    static ConstraintResult checkOrder(const vector<T>& v, bool isStrict) {
+        for (size_t begin = 1; begin < v.size(); begin += BLOCK_SIZE) {
+            size_t end = min(v.size(), begin + BLOCK_SIZE);
+            bool isValid = true;
+            for (size_t i = begin; i < end; i++) {
+                isValid &= isStrict ? (v[i - 1] < v[i]) : !(v[i] < v[i - 1]);
+            }
+            if (!isValid) {
+                for (size_t i = begin; i < end; i++) {
+                    if (isStrict ? !(v[i - 1] < v[i]) : v[i] < v[i - 1]) {
+                        return ConstraintResult::violated(
+                                "at " + index(i) + ": " + StringUtils::toString(v[i])
+                                + (isStrict ? " is not greater than " : " is less than ")
+                                + StringUtils::toString(v[i - 1]));
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+}
@@ -16,7 +16,9 @@ class BaseProblemSpec
           protected StyleConfigBuilder,
           protected GradingConfigBuilder,
           protected MultipleTestCasesConfigBuilder,
-          protected ConstraintSuiteBuilder {
+          protected ConstraintSuiteBuilder,
+          protected VectorConstraints,
+          protected GraphConstraints {
 private:
     vector<void(BaseProblemSpec::*)()> outputFormats_ = {
             &BaseProblemSpec::OutputFormat1,
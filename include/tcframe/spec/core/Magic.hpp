@@ -3,6 +3,7 @@
 #include <functional>
 #include <queue>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -11,19 +12,29 @@
 #include "tcframe/util.hpp"
 
 using std::function;
+using std::get;
 using std::move;
 using std::queue;
 using std::string;
+using std::tuple;
+using std::tuple_cat;
 using std::vector;
 
 #define CONS(predicate) addConstraint([=] {return predicate;}, #predicate)
 #define CASE(...) addOfficialTestCase([=] {__VA_ARGS__;}, #__VA_ARGS__)
 #define EMPTY_LINE() MagicLineIOSegmentBuilder(newLineIOSegment(), "")
-#define LINE(...) (MagicLineIOSegmentBuilder(newLineIOSegment(), #__VA_ARGS__), __VA_ARGS__)
-#define LINES(...) (MagicLinesIOSegmentBuilder(newLinesIOSegment(), #__VA_ARGS__), __VA_ARGS__)
 #define RAW_LINE(...) (MagicRawLineIOSegmentBuilder(newRawLineIOSegment(), #__VA_ARGS__), __VA_ARGS__)
 #define RAW_LINES(...) (MagicRawLinesIOSegmentBuilder(newRawLinesIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+
+#ifdef TCFRAME_TYPED_IO
+#define LINE(...) (TypedMagicLineIOSegmentBuilder<>(newLineIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+#define LINES(...) (TypedMagicLinesIOSegmentBuilder<>(newLinesIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+#define GRID(...) (TypedMagicGridIOSegmentBuilder<>(newGridIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+#else
+#define LINE(...) (MagicLineIOSegmentBuilder(newLineIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+#define LINES(...) (MagicLinesIOSegmentBuilder(newLinesIOSegment(), #__VA_ARGS__), __VA_ARGS__)
 #define GRID(...) (MagicGridIOSegmentBuilder(newGridIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+#endif
 
 #define SIZE_IMPL1(size) VectorSize([=] {return size;})
 #define SIZE_IMPL2(rows, columns) MatrixSize([=] {return rows;}, [=] {return columns;})
@@ -51,6 +62,17 @@ VectorWithSize<T> operator%(vector<T>& vektor, VectorSize size) {
     return {&vektor, size};
 }
 
+template<typename T>
+struct StreamedVectorWithSize {
+    StreamedVector<T>* vektor;
+    VectorSize size;
+};
+
+template<typename T>
+StreamedVectorWithSize<T> operator%(StreamedVector<T>& vektor, VectorSize size) {
+    return {&vektor, size};
+}
+
 struct MatrixSize {
     function<int()> rows;
     function<int()> columns;
@@ -116,6 +138,18 @@ public:
         return *this;
     }
 
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicLineIOSegmentBuilder& operator,(StreamedVector<T>& var) {
+        builder_->addVectorVariable(Vector::create(var, extractor_.nextName()));
+        return *this;
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicLineIOSegmentBuilder& operator,(const StreamedVectorWithSize<T>& var) {
+        builder_->addVectorVariable(Vector::create(*var.vektor, extractor_.nextName()), var.size.size);
+        return *this;
+    }
+
     template<typename T, typename = NotScalarCompatible<T>>
     MagicLineIOSegmentBuilder& operator,(T var) {
         throw runtime_error(
@@ -148,6 +182,12 @@ public:
         return *this;
     }
 
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicLinesIOSegmentBuilder& operator,(StreamedVector<T>& var) {
+        builder_->addVectorVariable(Vector::create(var, extractor_.nextName()));
+        return *this;
+    }
+
     template<typename T, typename = ScalarCompatible<T>>
     MagicLinesIOSegmentBuilder& operator,(vector<vector<T>>& var) {
         builder_->addJaggedVectorVariable(Matrix::create(var, extractor_.nextName()));
@@ -242,6 +282,17 @@ public:
         return *this;
     }
 
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicGridIOSegmentBuilder& operator,(Grid<T>& var) {
+        builder_->addMatrixVariable(Matrix::create(var, extractor_.nextName()));
+        return *this;
+    }
+
+    MagicGridIOSegmentBuilder& operator,(BitGrid& var) {
+        builder_->addMatrixVariable(Matrix::create(var, extractor_.nextName()));
+        return *this;
+    }
+
     template<typename T>
     MagicLineIOSegmentBuilder& operator,(T var) {
         throw runtime_error(
@@ -255,4 +306,279 @@ public:
     }
 };
 
+// The typed builders below are used for LINE(), LINES(), and GRID() when TCFRAME_TYPED_IO is defined.
+// Each variable appended with the comma operator yields a builder whose type records the variable's
+// concrete type. When the last builder of the chain is destroyed, it attaches a statically typed
+// segment implementation to the segment being built.
+
+template<typename... TVariables>
+class TypedMagicLineIOSegmentBuilder {
+    template<typename...>
+    friend class TypedMagicLineIOSegmentBuilder;
+
+private:
+    LineIOSegmentBuilder* builder_;
+    VariableNamesExtractor extractor_;
+    tuple<TVariables*...> variables_;
+    bool isLast_;
+
+    TypedMagicLineIOSegmentBuilder(
+            LineIOSegmentBuilder* builder,
+            VariableNamesExtractor extractor,
+            tuple<TVariables*...> variables)
+            : builder_(builder)
+            , extractor_(move(extractor))
+            , variables_(move(variables))
+            , isLast_(true) {}
+
+public:
+    ~TypedMagicLineIOSegmentBuilder() {
+        if (isLast_) {
+            attach(builder_, variables_);
+        }
+    }
+
+    TypedMagicLineIOSegmentBuilder(LineIOSegmentBuilder& builder, const string& names)
+            : TypedMagicLineIOSegmentBuilder(&builder, VariableNamesExtractor(names), tuple<TVariables*...>()) {}
+
+    TypedMagicLineIOSegmentBuilder(TypedMagicLineIOSegmentBuilder&& o)
+            : TypedMagicLineIOSegmentBuilder(o.builder_, move(o.extractor_), move(o.variables_)) {
+        o.isLast_ = false;
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLineIOSegmentBuilder<TVariables..., ScalarImpl<T>> operator,(T& var) {
+        ScalarImpl<T>* variable = new ScalarImpl<T>(var, extractor_.nextName());
+        builder_->addScalarVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLineIOSegmentBuilder<TVariables..., VectorImpl<T>> operator,(vector<T>& var) {
+        VectorImpl<T>* variable = new VectorImpl<T>(var, extractor_.nextName());
+        builder_->addVectorVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLineIOSegmentBuilder<TVariables..., VectorImpl<T>> operator,(const VectorWithSize<T>& var) {
+        VectorImpl<T>* variable = new VectorImpl<T>(*var.vektor, extractor_.nextName());
+        builder_->addVectorVariable(variable, var.size.size);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLineIOSegmentBuilder<TVariables..., StreamedVectorImpl<T>> operator,(StreamedVector<T>& var) {
+        StreamedVectorImpl<T>* variable = new StreamedVectorImpl<T>(var, extractor_.nextName());
+        builder_->addVectorVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLineIOSegmentBuilder<TVariables..., StreamedVectorImpl<T>> operator,(
+            const StreamedVectorWithSize<T>& var) {
+        StreamedVectorImpl<T>* variable = new StreamedVectorImpl<T>(*var.vektor, extractor_.nextName());
+        builder_->addVectorVariable(variable, var.size.size);
+        return next(variable);
+    }
+
+    template<typename T, typename = NotScalarCompatible<T>>
+    TypedMagicLineIOSegmentBuilder& operator,(T var) {
+        throw runtime_error(
+                "The type of variable " + TokenFormatter::formatVariable(extractor_.nextName())
+                + " is not supported for a line segment");
+    }
+
+    TypedMagicLineIOSegmentBuilder& operator%(const VectorSize&) {
+        throw runtime_error("Specifying size is not allowed after a line segment");
+    }
+
+    TypedMagicLineIOSegmentBuilder& operator%(const MatrixSize&) {
+        throw runtime_error("Specifying size is not allowed after a line segment");
+    }
+
+private:
+    template<typename TVariable>
+    TypedMagicLineIOSegmentBuilder<TVariables..., TVariable> next(TVariable* variable) {
+        isLast_ = false;
+        return {builder_, move(extractor_), tuple_cat(variables_, tuple<TVariable*>(variable))};
+    }
+
+    static void attach(LineIOSegmentBuilder*, const tuple<>&) {}
+
+    template<typename... Ts>
+    static void attach(LineIOSegmentBuilder* builder, const tuple<Ts*...>& variables) {
+        builder->setTypedSegment(new TypedLineIOSegment<Ts...>(variables));
+    }
+};
+
+template<typename... TColumns>
+class TypedMagicLinesIOSegmentBuilder {
+    template<typename...>
+    friend class TypedMagicLinesIOSegmentBuilder;
+
+private:
+    LinesIOSegmentBuilder* builder_;
+    VariableNamesExtractor extractor_;
+    tuple<TColumns*...> columns_;
+    bool isLast_;
+
+    TypedMagicLinesIOSegmentBuilder(
+            LinesIOSegmentBuilder* builder,
+            VariableNamesExtractor extractor,
+            tuple<TColumns*...> columns)
+            : builder_(builder)
+            , extractor_(move(extractor))
+            , columns_(move(columns))
+            , isLast_(true) {}
+
+public:
+    ~TypedMagicLinesIOSegmentBuilder() {
+        if (isLast_) {
+            attach(builder_, columns_);
+        }
+    }
+
+    TypedMagicLinesIOSegmentBuilder(LinesIOSegmentBuilder& builder, const string& names)
+            : TypedMagicLinesIOSegmentBuilder(&builder, VariableNamesExtractor(names), tuple<TColumns*...>()) {}
+
+    TypedMagicLinesIOSegmentBuilder(TypedMagicLinesIOSegmentBuilder&& o)
+            : TypedMagicLinesIOSegmentBuilder(o.builder_, move(o.extractor_), move(o.columns_)) {
+        o.isLast_ = false;
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLinesIOSegmentBuilder<TColumns..., VectorImpl<T>> operator,(vector<T>& var) {
+        VectorImpl<T>* variable = new VectorImpl<T>(var, extractor_.nextName());
+        builder_->addVectorVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLinesIOSegmentBuilder<TColumns..., StreamedVectorImpl<T>> operator,(StreamedVector<T>& var) {
+        StreamedVectorImpl<T>* variable = new StreamedVectorImpl<T>(var, extractor_.nextName());
+        builder_->addVectorVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicLinesIOSegmentBuilder<TColumns..., MatrixImpl<T>> operator,(vector<vector<T>>& var) {
+        MatrixImpl<T>* variable = new MatrixImpl<T>(var, extractor_.nextName());
+        builder_->addJaggedVectorVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T>
+    TypedMagicLinesIOSegmentBuilder& operator,(T var) {
+        throw runtime_error(
+                "The type of variable " + TokenFormatter::formatVariable(extractor_.nextName())
+                + " is not supported for a lines segment");
+    }
+
+    TypedMagicLinesIOSegmentBuilder& operator%(const VectorSize& size) {
+        builder_->setSize(size.size);
+        return *this;
+    }
+
+private:
+    template<typename TColumn>
+    TypedMagicLinesIOSegmentBuilder<TColumns..., TColumn> next(TColumn* column) {
+        isLast_ = false;
+        return {builder_, move(extractor_), tuple_cat(columns_, tuple<TColumn*>(column))};
+    }
+
+    static void attach(LinesIOSegmentBuilder*, const tuple<>&) {}
+
+    template<typename... Ts>
+    static void attach(LinesIOSegmentBuilder* builder, const tuple<Ts*...>& columns) {
+        builder->setTypedSegment(new TypedLinesIOSegment<Ts...>(columns));
+    }
+};
+
+template<typename... TVariables>
+class TypedMagicGridIOSegmentBuilder {
+    template<typename...>
+    friend class TypedMagicGridIOSegmentBuilder;
+
+private:
+    GridIOSegmentBuilder* builder_;
+    VariableNamesExtractor extractor_;
+    tuple<TVariables*...> variables_;
+    bool isLast_;
+
+    TypedMagicGridIOSegmentBuilder(
+            GridIOSegmentBuilder* builder,
+            VariableNamesExtractor extractor,
+            tuple<TVariables*...> variables)
+            : builder_(builder)
+            , extractor_(move(extractor))
+            , variables_(move(variables))
+            , isLast_(true) {}
+
+public:
+    ~TypedMagicGridIOSegmentBuilder() {
+        if (isLast_) {
+            attach(builder_, variables_);
+        }
+    }
+
+    TypedMagicGridIOSegmentBuilder(GridIOSegmentBuilder& builder, const string& names)
+            : TypedMagicGridIOSegmentBuilder(&builder, VariableNamesExtractor(names), tuple<TVariables*...>()) {}
+
+    TypedMagicGridIOSegmentBuilder(TypedMagicGridIOSegmentBuilder&& o)
+            : TypedMagicGridIOSegmentBuilder(o.builder_, move(o.extractor_), move(o.variables_)) {
+        o.isLast_ = false;
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicGridIOSegmentBuilder<TVariables..., MatrixImpl<T>> operator,(vector<vector<T>>& var) {
+        MatrixImpl<T>* variable = new MatrixImpl<T>(var, extractor_.nextName());
+        builder_->addMatrixVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    TypedMagicGridIOSegmentBuilder<TVariables..., GridImpl<T>> operator,(Grid<T>& var) {
+        GridImpl<T>* variable = new GridImpl<T>(var, extractor_.nextName());
+        builder_->addMatrixVariable(variable);
+        return next(variable);
+    }
+
+    TypedMagicGridIOSegmentBuilder<TVariables..., BitGridImpl> operator,(BitGrid& var) {
+        BitGridImpl* variable = new BitGridImpl(var, extractor_.nextName());
+        builder_->addMatrixVariable(variable);
+        return next(variable);
+    }
+
+    template<typename T>
+    TypedMagicGridIOSegmentBuilder& operator,(T var) {
+        throw runtime_error(
+                "The type of variable " + TokenFormatter::formatVariable(extractor_.nextName())
+                + " is not supported for a grid segment");
+    }
+
+    TypedMagicGridIOSegmentBuilder& operator%(const MatrixSize& size) {
+        builder_->setSize(size.rows, size.columns);
+        return *this;
+    }
+
+private:
+    template<typename TVariable>
+    TypedMagicGridIOSegmentBuilder<TVariables..., TVariable> next(TVariable* variable) {
+        isLast_ = false;
+        return {builder_, move(extractor_), tuple_cat(variables_, tuple<TVariable*>(variable))};
+    }
+
+    static void attach(GridIOSegmentBuilder*, const tuple<>&) {}
+
+    template<typename TVariable>
+    static void attach(GridIOSegmentBuilder* builder, const tuple<TVariable*>& variables) {
+        builder->setTypedSegment(new TypedGridIOSegment<TVariable>(get<0>(variables)));
+    }
+
+    // A grid with more than one variable is rejected by GridIOSegmentBuilder.
+    template<typename T1, typename T2, typename... Ts>
+    static void attach(GridIOSegmentBuilder*, const tuple<T1*, T2*, Ts*...>&) {}
+};
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "tcframe/spec/io/ChunkedParser.hpp"
+#include "tcframe/spec/io/ChunkedPrinter.hpp"
 #include "tcframe/spec/io/GridIOSegment.hpp"
 #include "tcframe/spec/io/GridIOSegmentManipulator.hpp"
 #include "tcframe/spec/io/IOFormat.hpp"
@@ -13,3 +15,7 @@
 #include "tcframe/spec/io/RawLineIOSegmentManipulator.hpp"
 #include "tcframe/spec/io/RawLinesIOSegment.hpp"
 #include "tcframe/spec/io/RawLinesIOSegmentManipulator.hpp"
+#include "tcframe/spec/io/TypedGridIOSegment.hpp"
+#include "tcframe/spec/io/TypedIOSegment.hpp"
+#include "tcframe/spec/io/TypedLineIOSegment.hpp"
+#include "tcframe/spec/io/TypedLinesIOSegment.hpp"
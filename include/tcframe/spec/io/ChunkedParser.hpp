@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IOSegment.hpp"
+#include "tcframe/util.hpp"
+
+using std::count;
+using std::function;
+using std::ios;
+using std::istream;
+using std::max;
+using std::memchr;
+using std::min;
+using std::runtime_error;
+using std::streambuf;
+using std::streamoff;
+using std::stringbuf;
+using std::streampos;
+using std::string;
+using std::thread;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Parses a sequence of rows, each terminated by a newline, on multiple threads. It only applies when
+ * the rest of the input is already in memory (e.g. a memory-mapped file), which is then split at
+ * newline boundaries into one chunk per thread. Each chunk is parsed through its own stream into
+ * preallocated slots. If some chunks fail, the error of the earliest one is reported, which is the
+ * error that parsing the rows sequentially would report.
+ */
+class ChunkedParser {
+public:
+    static const int MIN_CHUNK_BYTES = 1 << 20;
+
+private:
+    int threads_;
+
+public:
+    explicit ChunkedParser(int threads = 1)
+            : threads_(threads) {}
+
+    int threads() const {
+        return threads_;
+    }
+
+    // Parses the next `rows` rows, or all remaining rows if rows is NO_SIZE. prepare(rows) is called
+    // first, with the actual number of rows. Then, parseRows(in, begin, end) must parse the rows
+    // [begin, end), including their newlines, and must be safe to call concurrently for disjoint
+    // ranges. Returns false without consuming anything when the rows cannot be parsed in parallel,
+    // in which case the caller should parse them sequentially.
+    bool tryParse(
+            istream* in,
+            int rows,
+            const function<void(int)>& prepare,
+            const function<void(istream*, int, int)>& parseRows) const {
+
+        const char* begin;
+        const char* end;
+        if (threads_ <= 1 || rows == 0 || !getBufferedRest(in, begin, end) || end - begin < 2 * MIN_CHUNK_BYTES) {
+            return false;
+        }
+
+        int chunks = (int) min((long long) threads_, (long long) (end - begin) / MIN_CHUNK_BYTES);
+        vector<const char*> bounds(chunks + 1, end);
+        bounds[0] = begin;
+        for (int k = 1; k < chunks; k++) {
+            const char* target = max(bounds[k - 1], begin + (end - begin) / chunks * k);
+            const char* newline = (const char*) memchr(target, '\n', end - target);
+            bounds[k] = newline == nullptr ? end : newline + 1;
+        }
+
+        vector<int> chunkRows(chunks);
+        runConcurrently(chunks, [&](int k) {
+            chunkRows[k] = (int) count(bounds[k], bounds[k + 1], '\n');
+        });
+
+        if (rows == NO_SIZE) {
+            if (end[-1] != '\n') {
+                return false;
+            }
+            rows = 0;
+            for (int k = 0; k < chunks; k++) {
+                rows += chunkRows[k];
+            }
+        } else if (!truncate(rows, bounds, chunkRows)) {
+            return false;
+        }
+        chunks = (int) chunkRows.size();
+
+        prepare(rows);
+
+        vector<int> firstRows(chunks, 0);
+        for (int k = 1; k < chunks; k++) {
+            firstRows[k] = firstRows[k - 1] + chunkRows[k - 1];
+        }
+
+        vector<char> failed(chunks, false);
+        vector<string> errors(chunks);
+        runConcurrently(chunks, [&](int k) {
+            MemoryBuffer buffer(bounds[k], bounds[k + 1]);
+            istream chunkIn(&buffer);
+            try {
+                parseRows(&chunkIn, firstRows[k], firstRows[k] + chunkRows[k]);
+            } catch (runtime_error& e) {
+                failed[k] = true;
+                errors[k] = e.what();
+            }
+        });
+
+        for (int k = 0; k < chunks; k++) {
+            if (failed[k]) {
+                throw runtime_error(errors[k]);
+            }
+        }
+
+        in->seekg(bounds[chunks] - begin, ios::cur);
+        return true;
+    }
+
+private:
+    // Exposes the get area of any stream buffer.
+    class BufferAccess : public streambuf {
+    public:
+        static const char* current(streambuf* buf) {
+            return (buf->*&BufferAccess::gptr)();
+        }
+
+        static const char* end(streambuf* buf) {
+            return (buf->*&BufferAccess::egptr)();
+        }
+    };
+
+    // Succeeds if the get area of the stream buffer holds the whole rest of the input. Only in-memory
+    // buffers are checked, as seeking a file buffer discards what it has read ahead.
+    static bool getBufferedRest(istream* in, const char*& begin, const char*& end) {
+        if (!in->good()) {
+            return false;
+        }
+
+        streambuf* buf = in->rdbuf();
+        if (dynamic_cast<MemoryBuffer*>(buf) != nullptr) {
+            begin = BufferAccess::current(buf);
+            end = BufferAccess::end(buf);
+            return begin != nullptr;
+        }
+        if (dynamic_cast<stringbuf*>(buf) == nullptr) {
+            return false;
+        }
+
+        streampos current = buf->pubseekoff(0, ios::cur, ios::in);
+        streampos last = buf->pubseekoff(0, ios::end, ios::in);
+        if (current == streampos(streamoff(-1)) || last == streampos(streamoff(-1))) {
+            return false;
+        }
+        if (buf->pubseekpos(current, ios::in) != current) {
+            in->setstate(ios::failbit);
+            return false;
+        }
+
+        begin = BufferAccess::current(buf);
+        end = BufferAccess::end(buf);
+        return begin != nullptr && end - begin == last - current;
+    }
+
+    // Cuts the chunks right after the rows-th newline. Fails if there are fewer newlines.
+    static bool truncate(int rows, vector<const char*>& bounds, vector<int>& chunkRows) {
+        int seen = 0;
+        for (int k = 0; k < chunkRows.size(); k++) {
+            if (seen + chunkRows[k] >= rows) {
+                const char* p = bounds[k];
+                for (int i = seen; i < rows; i++) {
+                    p = (const char*) memchr(p, '\n', bounds[k + 1] - p) + 1;
+                }
+                bounds.resize(k + 2);
+                bounds[k + 1] = p;
+                chunkRows.resize(k + 1);
+                chunkRows[k] = rows - seen;
+                return true;
+            }
+            seen += chunkRows[k];
+        }
+        return false;
+    }
+
+    static void runConcurrently(int tasks, const function<void(int)>& task) {
+        vector<thread> workers;
+        for (int k = 1; k < tasks; k++) {
+            workers.emplace_back(task, k);
+        }
+        task(0);
+        for (thread& worker : workers) {
+            worker.join();
+        }
+    }
+};
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::current_exception;
+using std::exception_ptr;
+using std::function;
+using std::min;
+using std::ostream;
+using std::ostringstream;
+using std::rethrow_exception;
+using std::string;
+using std::thread;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Prints a sequence of items in chunks of CHUNK_SIZE items. Up to `threads` chunks at a time are
+ * formatted into separate buffers on their own threads, and then written out in order, so that the
+ * output is byte-identical to printing the items sequentially. Sequences shorter than two chunks,
+ * or when there is only one thread, are printed directly.
+ */
+class ChunkedPrinter {
+public:
+    static const int CHUNK_SIZE = 1 << 16;
+
+private:
+    int threads_;
+
+public:
+    explicit ChunkedPrinter(int threads = 1)
+            : threads_(threads) {}
+
+    int threads() const {
+        return threads_;
+    }
+
+    bool isParallel(int count) const {
+        return threads_ > 1 && count >= 2 * CHUNK_SIZE;
+    }
+
+    // printChunk(begin, end, out) must print the items in [begin, end) to out, and must be safe to call
+    // concurrently for disjoint ranges.
+    void print(int count, const function<void(int, int, ostream*)>& printChunk, ostream* out) const {
+        if (!isParallel(count)) {
+            printChunk(0, count, out);
+            return;
+        }
+
+        vector<string> buffers(threads_);
+        vector<exception_ptr> errors(threads_);
+        for (int begin = 0; begin < count; begin += threads_ * CHUNK_SIZE) {
+            int chunks = min(threads_, (count - begin + CHUNK_SIZE - 1) / CHUNK_SIZE);
+            auto formatChunk = [&, begin](int k) {
+                int chunkBegin = begin + k * CHUNK_SIZE;
+                int chunkEnd = min(count, chunkBegin + CHUNK_SIZE);
+                try {
+                    ostringstream buffer;
+                    buffer.copyfmt(*out);
+                    printChunk(chunkBegin, chunkEnd, &buffer);
+                    buffers[k] = buffer.str();
+                } catch (...) {
+                    errors[k] = current_exception();
+                }
+            };
+
+            vector<thread> workers;
+            for (int k = 1; k < chunks; k++) {
+                workers.emplace_back(formatChunk, k);
+            }
+            formatChunk(0);
+            for (thread& worker : workers) {
+                worker.join();
+            }
+
+            for (int k = 0; k < chunks; k++) {
+                if (errors[k]) {
+                    rethrow_exception(errors[k]);
+                }
+                out->write(buffers[k].data(), buffers[k].size());
+            }
+        }
+    }
+};
+
+}
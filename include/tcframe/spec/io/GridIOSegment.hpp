@@ -6,6 +6,7 @@
 #include <utility>
 
 #include "IOSegment.hpp"
+#include "TypedIOSegment.hpp"
 #include "tcframe/spec/variable.hpp"
 
 using std::function;
@@ -23,6 +24,7 @@ private:
     Matrix* variable_;
     function<int()> rows_;
     function<int()> columns_;
+    TypedIOSegment<GridIOSegment>* typedSegment_;
 
 public:
     virtual ~GridIOSegment() = default;
@@ -30,7 +32,8 @@ public:
     GridIOSegment()
             : variable_(nullptr)
             , rows_([] {return NO_SIZE;})
-            , columns_([] {return NO_SIZE;}) {}
+            , columns_([] {return NO_SIZE;})
+            , typedSegment_(nullptr) {}
 
     IOSegmentType type() const {
         return IOSegmentType::GRID;
@@ -48,6 +51,10 @@ public:
         return columns_;
     }
 
+    TypedIOSegment<GridIOSegment>* typedSegment() const {
+        return typedSegment_;
+    }
+
     bool operator==(const GridIOSegment& o) const {
         if (variable_ != nullptr && o.variable_ != nullptr) {
             if (!variable_->equals(o.variable_)) {
@@ -82,6 +89,11 @@ public:
         return *this;
     }
 
+    GridIOSegmentBuilder& setTypedSegment(TypedIOSegment<GridIOSegment>* typedSegment) {
+        subject_->typedSegment_ = typedSegment;
+        return *this;
+    }
+
     GridIOSegment* build() {
         checkState();
         return move(subject_);
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "ChunkedParser.hpp"
+#include "ChunkedPrinter.hpp"
 #include "GridIOSegment.hpp"
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
@@ -15,11 +17,38 @@ using std::runtime_error;
 namespace tcframe {
 
 class GridIOSegmentManipulator {
+private:
+    ChunkedPrinter printer_;
+    ChunkedParser parser_;
+
 public:
+    void setThreads(int threads) {
+        printer_ = ChunkedPrinter(threads);
+        parser_ = ChunkedParser(threads);
+    }
+
     string parse(GridIOSegment* segment, istream* in) {
         Matrix* variable = segment->variable();
         variable->clear();
-        variable->parseFrom(in, segment->rows()(), segment->columns()());
+
+        int rows = segment->rows()();
+        int columns = segment->columns()();
+        if (variable->canParseConcurrently() && parser_.tryParse(
+                in,
+                rows,
+                [variable, columns](int rows) {
+                    variable->resize(rows, columns);
+                },
+                [variable, columns](istream* chunkIn, int begin, int end) {
+                    variable->parseRowsFrom(chunkIn, begin, end, columns);
+                })) {
+            return TokenFormatter::formatMatrixElement(variable->name(), rows - 1, columns - 1);
+        }
+
+        if (segment->typedSegment() != nullptr) {
+            return segment->typedSegment()->parse(segment, in);
+        }
+        variable->parseFrom(in, rows, columns);
 
         return TokenFormatter::formatMatrixElement(
                 variable->name(),
@@ -31,6 +60,21 @@ public:
         checkMatrixSize(segment);
 
         Matrix* variable = segment->variable();
+        if (printer_.isParallel(variable->rows()) && variable->canPrintConcurrently()) {
+            printer_.print(variable->rows(), [variable](int begin, int end, ostream* chunkOut) {
+                for (int r = begin; r < end; r++) {
+                    variable->printRowTo(r, chunkOut);
+                    *chunkOut << endl;
+                }
+            }, out);
+            return;
+        }
+
+        if (segment->typedSegment() != nullptr) {
+            segment->typedSegment()->print(segment, out);
+            return;
+        }
+
         variable->printTo(out);
     }
 
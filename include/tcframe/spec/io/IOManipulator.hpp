@@ -38,6 +38,12 @@ public:
     explicit IOManipulator(IOFormat ioFormat)
             : ioFormat_(move(ioFormat)) {}
 
+    virtual void setThreads(int threads) {
+        gridIOSegmentManipulator.setThreads(threads);
+        lineIOSegmentManipulator.setThreads(threads);
+        linesIOSegmentManipulator.setThreads(threads);
+    }
+
     virtual void printInput(ostream* out) {
         print(ioFormat_.inputFormat(), out);
     }
@@ -50,24 +56,13 @@ public:
         if (!ioFormat_.outputFormats().empty()) {
             ioFormat_.beforeOutputFormat()();
 
-            long long initialPos = in->tellg();
-            bool successful = false;
-            string errorMessage;
+            vector<const IOSegments*> outputFormats;
             for (const IOSegments& outputFormat : ioFormat_.outputFormats()) {
-                try {
-                    parse(outputFormat, in);
-                    successful = true;
-                    break;
-                } catch (runtime_error& e) {
-                    in->clear();
-                    in->seekg(initialPos);
-                    if (errorMessage.empty()) {
-                        errorMessage = e.what();
-                    }
-                }
+                outputFormats.push_back(&outputFormat);
             }
 
-            if (!successful) {
+            string errorMessage;
+            if (!parseAnyOf(outputFormats, 0, "", in, errorMessage)) {
                 if (ioFormat_.outputFormats().size() == 1) {
                     throw runtime_error(errorMessage);
                 }
@@ -96,24 +91,79 @@ private:
     void parse(const IOSegments& segments, istream* in) {
         string lastVariableName;
         for (IOSegment* segment : segments) {
-            if (segment->type() == IOSegmentType::GRID) {
-                lastVariableName = gridIOSegmentManipulator.parse((GridIOSegment*) segment, in);
-            } else if (segment->type() == IOSegmentType::LINE) {
-                lastVariableName = lineIOSegmentManipulator.parse((LineIOSegment*) segment, in);
-            } else if (segment->type() == IOSegmentType::LINES) {
-                lastVariableName = linesIOSegmentManipulator.parse((LinesIOSegment*) segment, in);
-            } else if (segment->type() == IOSegmentType::RAW_LINE) {
-                lastVariableName = rawLineIOSegmentManipulator.parse((RawLineIOSegment*) segment, in);
-            } else if (segment->type() == IOSegmentType::RAW_LINES) {
-                lastVariableName = rawLinesIOSegmentManipulator.parse((RawLinesIOSegment*) segment, in);
+            lastVariableName = parse(segment, in);
+        }
+        ensureEof(in, lastVariableName);
+    }
+
+    // Tries the formats in order, whose first segmentIndex segments have been parsed. Consecutive formats
+    // having the same next segment are tried as a group, so that the segment is parsed only once for all
+    // of them, and only the remaining segments are reparsed when one of them does not match.
+    bool parseAnyOf(
+            const vector<const IOSegments*>& formats,
+            int segmentIndex,
+            const string& lastVariableName,
+            istream* in,
+            string& errorMessage) {
+
+        long long initialPos = in->tellg();
+        for (int i = 0, j; i < formats.size(); i = j) {
+            for (j = i + 1; j < formats.size(); j++) {
+                if (!hasSameSegment(*formats[i], *formats[j], segmentIndex)) {
+                    break;
+                }
             }
+
+            try {
+                if (segmentIndex == formats[i]->size()) {
+                    ensureEof(in, lastVariableName);
+                    return true;
+                }
+
+                vector<const IOSegments*> group(formats.begin() + i, formats.begin() + j);
+                string segmentLastVariableName = parse((*formats[i])[segmentIndex], in);
+                if (parseAnyOf(group, segmentIndex + 1, segmentLastVariableName, in, errorMessage)) {
+                    return true;
+                }
+            } catch (runtime_error& e) {
+                if (errorMessage.empty()) {
+                    errorMessage = e.what();
+                }
+            }
+            in->clear();
+            in->seekg(initialPos);
         }
+        return false;
+    }
+
+    string parse(IOSegment* segment, istream* in) {
+        if (segment->type() == IOSegmentType::GRID) {
+            return gridIOSegmentManipulator.parse((GridIOSegment*) segment, in);
+        } else if (segment->type() == IOSegmentType::LINE) {
+            return lineIOSegmentManipulator.parse((LineIOSegment*) segment, in);
+        } else if (segment->type() == IOSegmentType::LINES) {
+            return linesIOSegmentManipulator.parse((LinesIOSegment*) segment, in);
+        } else if (segment->type() == IOSegmentType::RAW_LINE) {
+            return rawLineIOSegmentManipulator.parse((RawLineIOSegment*) segment, in);
+        } else {
+            return rawLinesIOSegmentManipulator.parse((RawLinesIOSegment*) segment, in);
+        }
+    }
+
+    static void ensureEof(istream* in, const string& lastVariableName) {
         if (!lastVariableName.empty()) {
             WhitespaceManipulator::ensureEof(in, lastVariableName);
         } else {
             WhitespaceManipulator::ensureEof(in);
         }
     }
+
+    static bool hasSameSegment(const IOSegments& a, const IOSegments& b, int segmentIndex) {
+        if (a.size() == segmentIndex || b.size() == segmentIndex) {
+            return a.size() == b.size();
+        }
+        return a[segmentIndex]->equals(b[segmentIndex]);
+    }
 };
 
 }
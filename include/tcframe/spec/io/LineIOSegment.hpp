@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "IOSegment.hpp"
+#include "TypedIOSegment.hpp"
 #include "tcframe/spec/variable.hpp"
 
 using std::function;
@@ -50,6 +51,7 @@ struct LineIOSegment : public IOSegment {
 
 private:
     vector<LineIOSegmentVariable> variables_;
+    TypedIOSegment<LineIOSegment>* typedSegment_ = nullptr;
 
 public:
     virtual ~LineIOSegment() = default;
@@ -62,6 +64,10 @@ public:
         return variables_;
     }
 
+    TypedIOSegment<LineIOSegment>* typedSegment() const {
+        return typedSegment_;
+    }
+
     bool operator==(const LineIOSegment& o) const {
         return tie(variables_) == tie(o.variables_);
     }
@@ -96,6 +102,11 @@ public:
         return *this;
     }
 
+    LineIOSegmentBuilder& setTypedSegment(TypedIOSegment<LineIOSegment>* typedSegment) {
+        subject_->typedSegment_ = typedSegment;
+        return *this;
+    }
+
     LineIOSegment* build() {
         return subject_;
     }
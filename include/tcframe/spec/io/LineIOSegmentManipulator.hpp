@@ -3,6 +3,7 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "ChunkedPrinter.hpp"
 #include "LineIOSegment.hpp"
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
@@ -15,39 +16,56 @@ using std::runtime_error;
 namespace tcframe {
 
 class LineIOSegmentManipulator {
+private:
+    ChunkedPrinter printer_;
+
 public:
+    void setThreads(int threads) {
+        printer_ = ChunkedPrinter(threads);
+    }
+
     string parse(LineIOSegment* segment, istream* in) {
-        string lastVariableName;
+        if (segment->typedSegment() != nullptr) {
+            return segment->typedSegment()->parse(segment, in);
+        }
+
+        TokenContext lastToken;
         for (const LineIOSegmentVariable& segmentVariable : segment->variables()) {
             Variable* variable = segmentVariable.variable();
             int size = segmentVariable.size()();
 
             if (variable->type() == VariableType::SCALAR) {
-                if (!lastVariableName.empty()) {
-                    WhitespaceManipulator::parseSpace(in, lastVariableName);
+                if (!lastToken.empty()) {
+                    WhitespaceManipulator::parseSpace(in, lastToken);
                 }
                 parseScalar((Scalar*) variable, in);
-                lastVariableName = TokenFormatter::formatVariable(variable->name());
+                lastToken = TokenContext::variable(variable->name());
             } else {
-                if (!lastVariableName.empty()) {
+                if (!lastToken.empty()) {
                     if (size != NO_SIZE && size > 0) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
+                        WhitespaceManipulator::parseSpace(in, lastToken);
                     }
                     if (size == NO_SIZE && !WhitespaceManipulator::canParseNewline(in)) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
+                        WhitespaceManipulator::parseSpace(in, lastToken);
                     }
                 }
                 Vector* vectorVariable = (Vector*) variable;
                 parseVector(vectorVariable, size, in);
-                lastVariableName = TokenFormatter::formatVectorElement(variable->name(), vectorVariable->size() - 1);
+                lastToken = TokenContext::vectorElement(variable->name(), vectorVariable->size() - 1);
             }
         }
-        WhitespaceManipulator::parseNewline(in, lastVariableName);
+        WhitespaceManipulator::parseNewline(in, lastToken);
 
-        return lastVariableName;
+        return lastToken.toString();
     }
 
     void print(LineIOSegment* segment, ostream* out) {
+        if (segment->typedSegment() != nullptr && !hasVectorToPrintInChunks(segment)) {
+            checkVectorSizes(segment);
+            segment->typedSegment()->print(segment, out);
+            return;
+        }
+
         bool first = true;
         for (const LineIOSegmentVariable& segmentVariable : segment->variables()) {
             Variable* variable = segmentVariable.variable();
@@ -70,6 +88,29 @@ public:
     }
 
 private:
+    bool hasVectorToPrintInChunks(LineIOSegment* segment) const {
+        for (const LineIOSegmentVariable& segmentVariable : segment->variables()) {
+            Variable* variable = segmentVariable.variable();
+            if (variable->type() == VariableType::VECTOR && canPrintInChunks((Vector*) variable)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool canPrintInChunks(Vector* vektor) const {
+        return printer_.isParallel(vektor->size()) && vektor->canPrintConcurrently();
+    }
+
+    static void checkVectorSizes(LineIOSegment* segment) {
+        for (const LineIOSegmentVariable& segmentVariable : segment->variables()) {
+            Variable* variable = segmentVariable.variable();
+            if (variable->type() == VariableType::VECTOR) {
+                checkVectorSize((Vector*) variable, segmentVariable.size()());
+            }
+        }
+    }
+
     static void checkVectorSize(Vector* vektor, int size) {
         if (size != NO_SIZE && vektor->size() != size) {
             throw runtime_error(
@@ -96,9 +137,20 @@ private:
         scalar->printTo(out);
     }
 
-    static void printVector(Vector* vektor, int size, ostream* out) {
+    void printVector(Vector* vektor, int size, ostream* out) {
         checkVectorSize(vektor, size);
-        vektor->printTo(out);
+        if (canPrintInChunks(vektor)) {
+            printer_.print(vektor->size(), [vektor](int begin, int end, ostream* chunkOut) {
+                for (int i = begin; i < end; i++) {
+                    if (i > 0) {
+                        *chunkOut << ' ';
+                    }
+                    vektor->printElementTo(i, chunkOut);
+                }
+            }, out);
+        } else {
+            vektor->printTo(out);
+        }
     }
 };
 
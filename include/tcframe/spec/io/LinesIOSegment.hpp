@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "IOSegment.hpp"
+#include "TypedIOSegment.hpp"
 #include "tcframe/spec/variable.hpp"
 
 using std::function;
@@ -23,6 +24,7 @@ struct LinesIOSegment : public IOSegment {
 private:
     vector<Variable*> variables_;
     function<int()> size_;
+    TypedIOSegment<LinesIOSegment>* typedSegment_ = nullptr;
 
 public:
     virtual ~LinesIOSegment() = default;
@@ -39,6 +41,10 @@ public:
         return size_;
     }
 
+    TypedIOSegment<LinesIOSegment>* typedSegment() const {
+        return typedSegment_;
+    }
+
     bool operator==(const LinesIOSegment& o) const {
         if (size_() != o.size_()) {
             return false;
@@ -85,6 +91,11 @@ public:
         return *this;
     }
 
+    LinesIOSegmentBuilder& setTypedSegment(TypedIOSegment<LinesIOSegment>* typedSegment) {
+        subject_->typedSegment_ = typedSegment;
+        return *this;
+    }
+
     LinesIOSegment* build() {
         checkState();
         return move(subject_);
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "ChunkedParser.hpp"
+#include "ChunkedPrinter.hpp"
 #include "LinesIOSegment.hpp"
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
@@ -15,56 +17,128 @@ using std::runtime_error;
 namespace tcframe {
 
 class LinesIOSegmentManipulator {
+private:
+    ChunkedPrinter printer_;
+    ChunkedParser parser_;
+
 public:
+    void setThreads(int threads) {
+        printer_ = ChunkedPrinter(threads);
+        parser_ = ChunkedParser(threads);
+    }
+
     string parse(LinesIOSegment* segment, istream* in) {
+        int size = segment->size()();
         for (Variable* variable : segment->variables()) {
             if (variable->type() == VariableType::VECTOR) {
                 ((Vector*) variable)->clear();
+                if (size != NO_SIZE) {
+                    ((Vector*) variable)->reserve(size);
+                }
             } else {
                 ((Matrix*) variable)->clear();
             }
         }
 
-        string lastVariableName;
+        int parsedRows = 0;
+        if (canParseConcurrently(segment) && parser_.tryParse(
+                in,
+                size,
+                [segment, &parsedRows](int rows) {
+                    parsedRows = rows;
+                    for (Variable* variable : segment->variables()) {
+                        ((Vector*) variable)->resize(rows);
+                    }
+                },
+                [segment](istream* chunkIn, int begin, int end) {
+                    for (int j = begin; j < end; j++) {
+                        parseRow(segment, chunkIn, j, true);
+                    }
+                })) {
+            Variable* lastVariable = segment->variables().back();
+            return TokenContext::vectorElement(lastVariable->name(), parsedRows - 1).toString();
+        }
+
+        if (segment->typedSegment() != nullptr) {
+            return segment->typedSegment()->parse(segment, in);
+        }
+
+        TokenContext lastToken;
 
-        int size = segment->size()();
         for (int j = 0; j != size; j++) {
             if (size == NO_SIZE && WhitespaceManipulator::isEof(in)) {
                 break;
             }
-
-            bool isFirstColumn = true;
-            for (Variable* variable : segment->variables()) {
-                if (variable->type() == VariableType::VECTOR) {
-                    if (!isFirstColumn) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
-                    }
-                    ((Vector*) variable)->parseAndAddElementFrom(in);
-                    lastVariableName = TokenFormatter::formatVectorElement(variable->name(), j);
-                } else {
-                    if (!isFirstColumn && !WhitespaceManipulator::canParseNewline(in)) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
-                    }
-                    Matrix* matrixVariable = (Matrix*) variable;
-                    matrixVariable->parseAndAddRowFrom(in, j);
-                    lastVariableName = TokenFormatter::formatMatrixElement(
-                            variable->name(),
-                            j,
-                            matrixVariable->columns(j) - 1);
-                }
-                isFirstColumn = false;
-            }
-            WhitespaceManipulator::parseNewline(in, lastVariableName);
+            lastToken = parseRow(segment, in, j, false);
         }
 
-        return lastVariableName;
+        return lastToken.toString();
     }
 
     void print(LinesIOSegment* segment, ostream* out) {
         checkVectorSizes(segment);
 
         int size = getSize(segment);
-        for (int j = 0; j < size; j++) {
+        if (printer_.isParallel(size) && canPrintConcurrently(segment)) {
+            printer_.print(size, [segment](int begin, int end, ostream* chunkOut) {
+                printRows(segment, begin, end, chunkOut);
+            }, out);
+            return;
+        }
+
+        if (segment->typedSegment() != nullptr) {
+            segment->typedSegment()->print(segment, out);
+            return;
+        }
+
+        printRows(segment, 0, size, out);
+    }
+
+private:
+    // Parses the j-th row, either appending to the variables, or in place if they have been resized.
+    static TokenContext parseRow(LinesIOSegment* segment, istream* in, int j, bool inPlace) {
+        TokenContext lastToken;
+        bool isFirstColumn = true;
+        for (Variable* variable : segment->variables()) {
+            if (variable->type() == VariableType::VECTOR) {
+                if (!isFirstColumn) {
+                    WhitespaceManipulator::parseSpace(in, lastToken);
+                }
+                if (inPlace) {
+                    ((Vector*) variable)->parseElementAt(in, j);
+                } else {
+                    ((Vector*) variable)->parseAndAddElementFrom(in);
+                }
+                lastToken = TokenContext::vectorElement(variable->name(), j);
+            } else {
+                if (!isFirstColumn && !WhitespaceManipulator::canParseNewline(in)) {
+                    WhitespaceManipulator::parseSpace(in, lastToken);
+                }
+                Matrix* matrixVariable = (Matrix*) variable;
+                matrixVariable->parseAndAddRowFrom(in, j);
+                lastToken = TokenContext::matrixElement(
+                        variable->name(),
+                        j,
+                        matrixVariable->columns(j) - 1);
+            }
+            isFirstColumn = false;
+        }
+        WhitespaceManipulator::parseNewline(in, lastToken);
+        return lastToken;
+    }
+
+    // Only segments of vectors are parsed in place; jagged vectors have rows of unknown lengths.
+    static bool canParseConcurrently(LinesIOSegment* segment) {
+        for (Variable* variable : segment->variables()) {
+            if (variable->type() != VariableType::VECTOR || !variable->canParseConcurrently()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void printRows(LinesIOSegment* segment, int begin, int end, ostream* out) {
+        for (int j = begin; j < end; j++) {
             for (int i = 0; i < segment->variables().size(); i++) {
                 Variable *variable = segment->variables()[i];
                 if (variable->type() == VariableType::VECTOR) {
@@ -83,7 +157,15 @@ public:
         }
     }
 
-private:
+    static bool canPrintConcurrently(LinesIOSegment* segment) {
+        for (Variable* variable : segment->variables()) {
+            if (!variable->canPrintConcurrently()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     static int getSize(LinesIOSegment* segment) {
         int size = segment->size()();
         if (size != NO_SIZE) {
@@ -17,7 +17,7 @@ namespace tcframe {
 class RawLinesIOSegmentManipulator {
 public:
     string parse(RawLinesIOSegment* segment, istream* in) {
-        string lastVariableName;
+        TokenContext lastToken;
 
         Vector* variable = segment->variable();
         int size = segment->size()();
@@ -27,12 +27,12 @@ public:
             }
 
             variable->parseAndAddElementFrom(in);
-            lastVariableName = TokenFormatter::formatVectorElement(variable->name(), j);
+            lastToken = TokenContext::vectorElement(variable->name(), j);
 
-            WhitespaceManipulator::parseNewline(in, lastVariableName);
+            WhitespaceManipulator::parseNewline(in, lastToken);
         }
 
-        return lastVariableName;
+        return lastToken.toString();
     }
 
     void print(RawLinesIOSegment* segment, ostream* out) {
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "GridIOSegment.hpp"
+#include "TypedIOSegment.hpp"
+#include "tcframe/spec/variable.hpp"
+
+using std::istream;
+using std::ostream;
+using std::string;
+
+namespace tcframe {
+
+// Grid segment whose variable is a MatrixImpl<T> or GridImpl<T>, accessed without virtual calls.
+template<typename TMatrix>
+class TypedGridIOSegment : public TypedIOSegment<GridIOSegment> {
+private:
+    TMatrix* variable_;
+
+public:
+    virtual ~TypedGridIOSegment() = default;
+
+    explicit TypedGridIOSegment(TMatrix* variable)
+            : variable_(variable) {}
+
+    string parse(GridIOSegment* segment, istream* in) {
+        variable_->TMatrix::parseFrom(in, segment->rows()(), segment->columns()());
+
+        int lastRow = variable_->TMatrix::rows() - 1;
+        return TokenFormatter::formatMatrixElement(
+                variable_->name(),
+                lastRow,
+                variable_->TMatrix::columns(lastRow) - 1);
+    }
+
+    void print(GridIOSegment*, ostream* out) {
+        int rows = variable_->TMatrix::rows();
+        for (int r = 0; r < rows; r++) {
+            variable_->TMatrix::printRowTo(r, out);
+            *out << '\n';
+        }
+    }
+};
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+using std::istream;
+using std::ostream;
+using std::string;
+
+namespace tcframe {
+
+// Statically typed implementation of parsing and printing a segment, built when the variables'
+// concrete types are known at compile time (see TCFRAME_TYPED_IO in Magic.hpp). Size checks are
+// still done by the segment manipulator before delegating here.
+template<typename TSegment>
+class TypedIOSegment {
+public:
+    virtual ~TypedIOSegment() = default;
+
+    virtual string parse(TSegment* segment, istream* in) = 0;
+    virtual void print(TSegment* segment, ostream* out) = 0;
+};
+
+}
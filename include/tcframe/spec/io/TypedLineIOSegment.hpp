@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "LineIOSegment.hpp"
+#include "TypedIOSegment.hpp"
+#include "tcframe/spec/variable.hpp"
+
+using std::get;
+using std::istream;
+using std::move;
+using std::ostream;
+using std::size_t;
+using std::string;
+using std::tuple;
+
+namespace tcframe {
+
+// Line segment whose variables are ScalarImpl<T> or vector implementations (e.g. VectorImpl<T>). The
+// variables are unrolled at compile time, and values are accessed without virtual calls.
+template<typename... TVariables>
+class TypedLineIOSegment : public TypedIOSegment<LineIOSegment> {
+private:
+    template<size_t I>
+    struct Position {};
+
+    tuple<TVariables*...> variables_;
+
+public:
+    virtual ~TypedLineIOSegment() = default;
+
+    explicit TypedLineIOSegment(tuple<TVariables*...> variables)
+            : variables_(move(variables)) {}
+
+    string parse(LineIOSegment* segment, istream* in) {
+        TokenContext lastToken;
+        parseVariables(segment, in, lastToken, Position<0>());
+        WhitespaceManipulator::parseNewline(in, lastToken);
+
+        return lastToken.toString();
+    }
+
+    void print(LineIOSegment* segment, ostream* out) {
+        printVariables(out, Position<0>());
+        *out << '\n';
+    }
+
+private:
+    void parseVariables(LineIOSegment*, istream*, TokenContext&, Position<sizeof...(TVariables)>) {}
+
+    template<size_t I>
+    void parseVariables(LineIOSegment* segment, istream* in, TokenContext& lastToken, Position<I>) {
+        int size = segment->variables()[I].size()();
+        parseVariable(get<I>(variables_), size, in, lastToken);
+        parseVariables(segment, in, lastToken, Position<I + 1>());
+    }
+
+    void printVariables(ostream*, Position<sizeof...(TVariables)>) {}
+
+    template<size_t I>
+    void printVariables(ostream* out, Position<I>) {
+        printVariable(get<I>(variables_), I == 0, out);
+        printVariables(out, Position<I + 1>());
+    }
+
+    template<typename T>
+    static void parseVariable(ScalarImpl<T>* variable, int, istream* in, TokenContext& lastToken) {
+        if (!lastToken.empty()) {
+            WhitespaceManipulator::parseSpace(in, lastToken);
+        }
+        variable->ScalarImpl<T>::parseFrom(in);
+        lastToken = TokenContext::variable(variable->name());
+    }
+
+    template<typename TVector>
+    static void parseVariable(TVector* variable, int size, istream* in, TokenContext& lastToken) {
+        if (!lastToken.empty()) {
+            if (size != NO_SIZE && size > 0) {
+                WhitespaceManipulator::parseSpace(in, lastToken);
+            }
+            if (size == NO_SIZE && !WhitespaceManipulator::canParseNewline(in)) {
+                WhitespaceManipulator::parseSpace(in, lastToken);
+            }
+        }
+        variable->TVector::clear();
+        parseElements(variable, size, in);
+        lastToken = TokenContext::vectorElement(variable->name(), variable->TVector::size() - 1);
+    }
+
+    // Same as TVector::parseFrom(), but without a virtual call per element.
+    template<typename TVector>
+    static void parseElements(TVector* variable, int size, istream* in) {
+        if (size == NO_SIZE) {
+            for (int i = 0; !WhitespaceManipulator::canParseNewline(in); i++) {
+                if (i > 0) {
+                    WhitespaceManipulator::parseSpaceAfterMissingNewline(
+                            in,
+                            TokenContext::vectorElement(variable->name(), i - 1));
+                }
+                variable->TVector::parseAndAddElementFrom(in);
+            }
+        } else {
+            variable->TVector::reserve(size);
+            for (int i = 0; i < size; i++) {
+                if (i > 0) {
+                    WhitespaceManipulator::parseSpace(in, TokenContext::vectorElement(variable->name(), i - 1));
+                }
+                variable->TVector::parseAndAddElementFrom(in);
+            }
+        }
+    }
+
+    template<typename T>
+    static void printVariable(ScalarImpl<T>* variable, bool isFirst, ostream* out) {
+        if (!isFirst) {
+            *out << ' ';
+        }
+        variable->ScalarImpl<T>::printTo(out);
+    }
+
+    template<typename TVector>
+    static void printVariable(TVector* variable, bool isFirst, ostream* out) {
+        if (!isFirst && variable->TVector::size() != 0) {
+            *out << ' ';
+        }
+        variable->TVector::printTo(out);
+    }
+};
+
+}
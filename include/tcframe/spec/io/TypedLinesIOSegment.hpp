@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "LinesIOSegment.hpp"
+#include "TypedIOSegment.hpp"
+#include "tcframe/spec/variable.hpp"
+
+using std::get;
+using std::istream;
+using std::move;
+using std::ostream;
+using std::size_t;
+using std::string;
+using std::tuple;
+
+namespace tcframe {
+
+// Lines segment whose columns are vector implementations (e.g. VectorImpl<T>) or MatrixImpl<T> (a
+// jagged vector, last column only). The columns are unrolled at compile time, and elements are
+// accessed without virtual calls.
+template<typename... TColumns>
+class TypedLinesIOSegment : public TypedIOSegment<LinesIOSegment> {
+private:
+    template<size_t I>
+    struct Column {};
+
+    tuple<TColumns*...> columns_;
+
+public:
+    virtual ~TypedLinesIOSegment() = default;
+
+    explicit TypedLinesIOSegment(tuple<TColumns*...> columns)
+            : columns_(move(columns)) {}
+
+    string parse(LinesIOSegment* segment, istream* in) {
+        TokenContext lastToken;
+
+        int size = segment->size()();
+        for (int j = 0; j != size; j++) {
+            if (size == NO_SIZE && WhitespaceManipulator::isEof(in)) {
+                break;
+            }
+            parseRow(in, j, lastToken, Column<0>());
+            WhitespaceManipulator::parseNewline(in, lastToken);
+        }
+
+        return lastToken.toString();
+    }
+
+    void print(LinesIOSegment* segment, ostream* out) {
+        int size = segment->size()();
+        if (size == NO_SIZE) {
+            size = sizeOf(get<0>(columns_));
+        }
+        for (int j = 0; j < size; j++) {
+            printRow(out, j, Column<0>());
+            *out << '\n';
+        }
+    }
+
+private:
+    void parseRow(istream*, int, TokenContext&, Column<sizeof...(TColumns)>) {}
+
+    template<size_t I>
+    void parseRow(istream* in, int j, TokenContext& lastToken, Column<I>) {
+        parseElement(get<I>(columns_), I == 0, in, j, lastToken);
+        parseRow(in, j, lastToken, Column<I + 1>());
+    }
+
+    void printRow(ostream*, int, Column<sizeof...(TColumns)>) {}
+
+    template<size_t I>
+    void printRow(ostream* out, int j, Column<I>) {
+        printElement(get<I>(columns_), I == 0, out, j);
+        printRow(out, j, Column<I + 1>());
+    }
+
+    template<typename TVector>
+    static void parseElement(TVector* variable, bool isFirstColumn, istream* in, int j, TokenContext& lastToken) {
+        if (!isFirstColumn) {
+            WhitespaceManipulator::parseSpace(in, lastToken);
+        }
+        variable->TVector::parseAndAddElementFrom(in);
+        lastToken = TokenContext::vectorElement(variable->name(), j);
+    }
+
+    template<typename T>
+    static void parseElement(MatrixImpl<T>* variable, bool isFirstColumn, istream* in, int j, TokenContext& lastToken) {
+        if (!isFirstColumn && !WhitespaceManipulator::canParseNewline(in)) {
+            WhitespaceManipulator::parseSpace(in, lastToken);
+        }
+        variable->MatrixImpl<T>::parseAndAddRowFrom(in, j);
+        lastToken = TokenContext::matrixElement(variable->name(), j, variable->MatrixImpl<T>::columns(j) - 1);
+    }
+
+    template<typename TVector>
+    static void printElement(TVector* variable, bool isFirstColumn, ostream* out, int j) {
+        if (!isFirstColumn) {
+            *out << ' ';
+        }
+        variable->TVector::printElementTo(j, out);
+    }
+
+    template<typename T>
+    static void printElement(MatrixImpl<T>* variable, bool isFirstColumn, ostream* out, int j) {
+        if (!isFirstColumn && variable->MatrixImpl<T>::columns(j) > 0) {
+            *out << ' ';
+        }
+        variable->MatrixImpl<T>::printRowTo(j, out);
+    }
+
+    template<typename TVector>
+    static int sizeOf(TVector* variable) {
+        return variable->TVector::size();
+    }
+
+    template<typename T>
+    static int sizeOf(MatrixImpl<T>* variable) {
+        return variable->MatrixImpl<T>::rows();
+    }
+};
+
+}
@@ -1,3 +1,8 @@
 #pragma once
 
+#include "tcframe/spec/random/AliasSampler.hpp"
+#include "tcframe/spec/random/GeometryGenerator.hpp"
+#include "tcframe/spec/random/GraphGenerator.hpp"
 #include "tcframe/spec/random/Random.hpp"
+#include "tcframe/spec/random/SequenceGenerator.hpp"
+#include "tcframe/spec/random/Xoshiro256.hpp"
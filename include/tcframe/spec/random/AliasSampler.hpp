@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+
+#include "Random.hpp"
+
+using std::runtime_error;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Samples index i with probability proportional to weights[i] in O(1) per sample, after O(n)
+ * preprocessing (Vose's alias method).
+ */
+class AliasSampler {
+private:
+    vector<double> probabilities_;
+    vector<int> aliases_;
+
+public:
+    explicit AliasSampler(const vector<double>& weights)
+            : probabilities_(weights.size())
+            , aliases_(weights.size()) {
+
+        int n = (int) weights.size();
+        double total = 0;
+        for (double weight : weights) {
+            if (weight < 0) {
+                throw runtime_error("Weights must be non-negative");
+            }
+            total += weight;
+        }
+        if (!(total > 0)) {
+            throw runtime_error("Weights must have a positive sum");
+        }
+
+        vector<int> small;
+        vector<int> large;
+        for (int i = 0; i < n; i++) {
+            probabilities_[i] = weights[i] * n / total;
+            aliases_[i] = i;
+            (probabilities_[i] < 1 ? small : large).push_back(i);
+        }
+        while (!small.empty() && !large.empty()) {
+            int s = small.back();
+            int l = large.back();
+            small.pop_back();
+            aliases_[s] = l;
+            probabilities_[l] -= 1 - probabilities_[s];
+            if (probabilities_[l] < 1) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+
+        // Whatever is left is 1 up to rounding errors.
+        for (int i : small) {
+            probabilities_[i] = 1;
+        }
+        for (int i : large) {
+            probabilities_[i] = 1;
+        }
+    }
+
+    int size() const {
+        return (int) probabilities_.size();
+    }
+
+    int next(Random* rnd) const {
+        int i = rnd->nextInt(size());
+        return rnd->nextDouble(0, 1) < probabilities_[i] ? i : aliases_[i];
+    }
+};
+
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Random.hpp"
+#include "SequenceGenerator.hpp"
+#include "tcframe/util.hpp"
+
+using std::max;
+using std::max_element;
+using std::min;
+using std::min_element;
+using std::pair;
+using std::rotate;
+using std::runtime_error;
+using std::sort;
+using std::swap;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Generates point sets with guaranteed geometric properties directly, without rejection sampling, in
+ * O(n log n) time. All coordinates are within [minCoord, maxCoord]. To keep every intermediate
+ * product within long long, each structure spans at most MAX_SPAN in each axis; it is then placed at
+ * a random position within the range.
+ */
+class GeometryGenerator {
+public:
+    static const long long MAX_SPAN = 1LL << 31;
+
+private:
+    Random* rnd_;
+
+public:
+    explicit GeometryGenerator(Random* rnd)
+            : rnd_(rnd) {}
+
+    // n distinct points, no three of which are collinear. They are the points (x, x^2 mod p) for n
+    // distinct x in [0, p), for a prime p >= n, which no line meets more than twice; then randomly
+    // reflected, transposed, and translated.
+    void nextPointsInGeneralPosition(
+            int n, long long minCoord, long long maxCoord, vector<long long>& X, vector<long long>& Y) {
+
+        long long span = spanOf(minCoord, maxCoord);
+        long long p = findPrime(rnd_->nextLongLong(n, max((long long) n, span)), n, span);
+        if (p == 0) {
+            throw runtime_error("Cannot place " + StringUtils::toString(n) + " points in general position within "
+                    + StringUtils::toString(span) + " coordinates");
+        }
+
+        X = SequenceGenerator(rnd_).nextDistinct(n, 0, p - 1);
+        rnd_->shuffle(X.begin(), X.end());
+        Y.resize(n);
+        for (int i = 0; i < n; i++) {
+            Y[i] = X[i] * X[i] % p;
+        }
+        place(X, Y, p - 1, p - 1, minCoord, maxCoord);
+    }
+
+    // The vertices of a strictly convex polygon with n vertices, in counterclockwise order. Uses Valtr's
+    // algorithm on distinct lattice coordinates, with parallel edges merged; the polygon is generated
+    // with some spare vertices, and then random vertices are dropped, which keeps it strictly convex.
+    void nextConvexPolygon(
+            int n, long long minCoord, long long maxCoord, vector<long long>& X, vector<long long>& Y) {
+
+        if (n < 3) {
+            throw runtime_error("Convex polygon must have at least 3 vertices");
+        }
+        long long span = spanOf(minCoord, maxCoord);
+
+        vector<pair<long long, long long>> vertices;
+        for (int spare = n / 8 + 3; (long long) vertices.size() < n; spare *= 2) {
+            int count = (int) min((long long) n + spare, span);
+            if (count < n) {
+                throw runtime_error("Cannot place a convex polygon with " + StringUtils::toString(n)
+                        + " vertices within " + StringUtils::toString(span) + " coordinates");
+            }
+            vertices = buildConvexPolygon(count, span);
+            if (count == span && (long long) vertices.size() < n) {
+                throw runtime_error("Cannot place a convex polygon with " + StringUtils::toString(n)
+                        + " vertices within " + StringUtils::toString(span) + " coordinates");
+            }
+        }
+
+        vector<long long> kept = SequenceGenerator(rnd_).nextDistinct(n, 0, (long long) vertices.size() - 1);
+        X.resize(n);
+        Y.resize(n);
+        long long width = 0;
+        long long height = 0;
+        for (int i = 0; i < n; i++) {
+            X[i] = vertices[kept[i]].first;
+            Y[i] = vertices[kept[i]].second;
+        }
+        normalize(X, width);
+        normalize(Y, height);
+
+        // Rotate the starting vertex, keeping the counterclockwise order.
+        int start = rnd_->nextInt(n);
+        rotate(X.begin(), X.begin() + start, X.end());
+        rotate(Y.begin(), Y.begin() + start, Y.end());
+        translate(X, width, minCoord, maxCoord);
+        translate(Y, height, minCoord, maxCoord);
+    }
+
+    // n segments, no two of which share a point: the 2n endpoints have distinct x-coordinates (or
+    // y-coordinates, if transposed), and each segment connects two consecutive ones.
+    void nextNonIntersectingSegments(
+            int n, long long minCoord, long long maxCoord,
+            vector<long long>& X1, vector<long long>& Y1, vector<long long>& X2, vector<long long>& Y2) {
+
+        long long span = spanOf(minCoord, maxCoord);
+        if (2LL * n > span) {
+            throw runtime_error("Cannot place " + StringUtils::toString(n) + " non-intersecting segments within "
+                    + StringUtils::toString(span) + " coordinates");
+        }
+
+        vector<long long> xs = SequenceGenerator(rnd_).nextDistinct(2 * n, 0, span - 1);
+        vector<long long> ys = rnd_->nextLongLongs(2 * n, 0, span - 1);
+        vector<int> order(n);
+        for (int i = 0; i < n; i++) {
+            order[i] = i;
+        }
+        rnd_->shuffle(order.begin(), order.end());
+
+        vector<long long> X(2 * n), Y(2 * n);
+        for (int i = 0; i < n; i++) {
+            int a = 2 * order[i];
+            int b = a + 1;
+            if (rnd_->nextInt(2)) {
+                swap(a, b);
+            }
+            X[2 * i] = xs[a];
+            Y[2 * i] = ys[a];
+            X[2 * i + 1] = xs[b];
+            Y[2 * i + 1] = ys[b];
+        }
+        place(X, Y, span - 1, span - 1, minCoord, maxCoord);
+
+        X1.resize(n);
+        Y1.resize(n);
+        X2.resize(n);
+        Y2.resize(n);
+        for (int i = 0; i < n; i++) {
+            X1[i] = X[2 * i];
+            Y1[i] = Y[2 * i];
+            X2[i] = X[2 * i + 1];
+            Y2[i] = Y[2 * i + 1];
+        }
+    }
+
+private:
+    static long long spanOf(long long minCoord, long long maxCoord) {
+        long long span = maxCoord - minCoord + 1;
+        return span < MAX_SPAN ? span : MAX_SPAN;
+    }
+
+    // Returns a prime in [lo, hi], searching from target upwards and then downwards, or 0 if none.
+    static long long findPrime(long long target, long long lo, long long hi) {
+        for (long long p = target; p <= hi; p++) {
+            if (isPrime(p)) {
+                return p;
+            }
+        }
+        for (long long p = target - 1; p >= lo; p--) {
+            if (isPrime(p)) {
+                return p;
+            }
+        }
+        return 0;
+    }
+
+    static bool isPrime(long long x) {
+        if (x < 2) {
+            return false;
+        }
+        for (long long d = 2; d * d <= x; d++) {
+            if (x % d == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    vector<pair<long long, long long>> buildConvexPolygon(int count, long long span) {
+        SequenceGenerator sequenceGenerator(rnd_);
+        vector<long long> dxs = splitIntoChains(sequenceGenerator.nextDistinct(count, 0, span - 1));
+        vector<long long> dys = splitIntoChains(sequenceGenerator.nextDistinct(count, 0, span - 1));
+        rnd_->shuffle(dys.begin(), dys.end());
+
+        vector<pair<long long, long long>> edges(count);
+        for (int i = 0; i < count; i++) {
+            edges[i] = {dxs[i], dys[i]};
+        }
+        sort(edges.begin(), edges.end(), [](const pair<long long, long long>& a, const pair<long long, long long>& b) {
+            bool isUpperA = a.second > 0 || (a.second == 0 && a.first > 0);
+            bool isUpperB = b.second > 0 || (b.second == 0 && b.first > 0);
+            if (isUpperA != isUpperB) {
+                return isUpperA;
+            }
+            return cross(a, b) > 0;
+        });
+
+        vector<pair<long long, long long>> vertices;
+        pair<long long, long long> current = {0, 0};
+        for (int i = 0; i < count; i++) {
+            current.first += edges[i].first;
+            current.second += edges[i].second;
+
+            // Merge parallel edges, as their common vertex would not be strictly convex.
+            if (i + 1 < count && cross(edges[i], edges[i + 1]) == 0) {
+                continue;
+            }
+            vertices.push_back(current);
+        }
+        return vertices;
+    }
+
+    // Splits the sorted, distinct values into two chains from the minimum to the maximum, and returns
+    // the differences along both chains, which sum up to zero.
+    vector<long long> splitIntoChains(const vector<long long>& values) {
+        int count = (int) values.size();
+        vector<long long> differences;
+        differences.reserve(count);
+        long long lastA = values[0];
+        long long lastB = values[0];
+        for (int i = 1; i + 1 < count; i++) {
+            if (rnd_->nextInt(2)) {
+                differences.push_back(values[i] - lastA);
+                lastA = values[i];
+            } else {
+                differences.push_back(lastB - values[i]);
+                lastB = values[i];
+            }
+        }
+        differences.push_back(values[count - 1] - lastA);
+        differences.push_back(lastB - values[count - 1]);
+        return differences;
+    }
+
+    static long long cross(const pair<long long, long long>& a, const pair<long long, long long>& b) {
+        return a.first * b.second - a.second * b.first;
+    }
+
+    // Shifts the values so that the minimum is 0, and returns the resulting maximum as extent.
+    static void normalize(vector<long long>& values, long long& extent) {
+        long long lo = *min_element(values.begin(), values.end());
+        for (long long& value : values) {
+            value -= lo;
+        }
+        extent = *max_element(values.begin(), values.end());
+    }
+
+    // Moves values in [0, extent] to a random position within [minCoord, maxCoord].
+    void translate(vector<long long>& values, long long extent, long long minCoord, long long maxCoord) {
+        long long offset = minCoord + rnd_->nextLongLong(0, maxCoord - minCoord - extent);
+        for (long long& value : values) {
+            value += offset;
+        }
+    }
+
+    // Randomly reflects and transposes points in [0, width] x [0, height], then translates them.
+    void place(vector<long long>& X, vector<long long>& Y, long long width, long long height,
+               long long minCoord, long long maxCoord) {
+
+        if (rnd_->nextInt(2)) {
+            for (long long& x : X) {
+                x = width - x;
+            }
+        }
+        if (rnd_->nextInt(2)) {
+            for (long long& y : Y) {
+                y = height - y;
+            }
+        }
+        if (rnd_->nextInt(2)) {
+            swap(X, Y);
+            swap(width, height);
+        }
+        translate(X, width, minCoord, maxCoord);
+        translate(Y, height, minCoord, maxCoord);
+    }
+};
+
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Random.hpp"
+#include "tcframe/util.hpp"
+
+using std::pair;
+using std::runtime_error;
+using std::size_t;
+using std::swap;
+using std::unordered_set;
+using std::vector;
+
+namespace tcframe {
+
+enum class TreeShape {
+    // Uniformly random among all labeled trees, via a random Prufer sequence.
+    RANDOM,
+
+    // Each vertex is attached to a uniformly random earlier vertex; the expected depth is logarithmic.
+    RANDOM_ATTACHMENT,
+
+    LINE,
+    STAR,
+
+    // A path (the spine) of random length, with every other vertex attached to a spine vertex.
+    CATERPILLAR,
+
+    // Each vertex has at most two children.
+    BINARY
+};
+
+/*
+ * Generates random trees and connected graphs as edge lists, where the i-th edge connects U[i] and
+ * V[i], and the vertices are firstVertex, ..., firstVertex + n - 1. Vertex labels, edge order, and
+ * edge directions are all randomized. Everything runs in (expected) linear time.
+ */
+class GraphGenerator {
+private:
+    Random* rnd_;
+
+public:
+    explicit GraphGenerator(Random* rnd)
+            : rnd_(rnd) {}
+
+    void nextTree(int n, vector<int>& U, vector<int>& V, TreeShape shape = TreeShape::RANDOM, int firstVertex = 1) {
+        if (n < 1) {
+            throw runtime_error("Tree must have at least 1 vertex");
+        }
+        vector<pair<int, int>> edges = buildTree(n, shape);
+        relabel(n, edges);
+        output(edges, U, V, firstVertex);
+    }
+
+    // A connected simple graph with exactly m edges.
+    void nextConnectedGraph(int n, long long m, vector<int>& U, vector<int>& V, int firstVertex = 1) {
+        long long maxEdges = (long long) n * (n - 1) / 2;
+        if (n < 1 || m < n - 1 || m > maxEdges) {
+            throw runtime_error("Connected graph with " + StringUtils::toString(n) + " vertices must have between "
+                    + StringUtils::toString(n - 1) + " and " + StringUtils::toString(maxEdges) + " edges");
+        }
+
+        vector<pair<int, int>> edges = buildTree(n, TreeShape::RANDOM);
+        unordered_set<long long> keys;
+        keys.reserve((size_t) m);
+        for (const pair<int, int>& edge : edges) {
+            keys.insert(key(n, edge.first, edge.second));
+        }
+
+        if (2 * m <= maxEdges) {
+            // Sparse: at least half of the candidate edges are free, so rejection takes O(1) expected tries.
+            while ((long long) edges.size() < m) {
+                int u = rnd_->nextInt(n);
+                int v = rnd_->nextInt(n);
+                if (u != v && keys.insert(key(n, u, v)).second) {
+                    edges.emplace_back(u, v);
+                }
+            }
+        } else {
+            // Dense: n^2 = O(m), so pick from all remaining candidate edges by a partial shuffle.
+            vector<pair<int, int>> candidates;
+            candidates.reserve((size_t) (maxEdges - (n - 1)));
+            for (int u = 0; u < n; u++) {
+                for (int v = u + 1; v < n; v++) {
+                    if (!keys.count(key(n, u, v))) {
+                        candidates.emplace_back(u, v);
+                    }
+                }
+            }
+            long long needed = m - (n - 1);
+            for (long long i = 0; i < needed; i++) {
+                long long j = rnd_->nextLongLong(i, (long long) candidates.size() - 1);
+                swap(candidates[i], candidates[j]);
+                edges.push_back(candidates[i]);
+            }
+        }
+
+        relabel(n, edges);
+        output(edges, U, V, firstVertex);
+    }
+
+private:
+    vector<pair<int, int>> buildTree(int n, TreeShape shape) {
+        vector<pair<int, int>> edges;
+        edges.reserve(n - 1);
+        if (shape == TreeShape::RANDOM) {
+            buildPruferTree(n, edges);
+        } else if (shape == TreeShape::RANDOM_ATTACHMENT) {
+            for (int v = 1; v < n; v++) {
+                edges.emplace_back(rnd_->nextInt(v), v);
+            }
+        } else if (shape == TreeShape::LINE) {
+            for (int v = 1; v < n; v++) {
+                edges.emplace_back(v - 1, v);
+            }
+        } else if (shape == TreeShape::STAR) {
+            for (int v = 1; v < n; v++) {
+                edges.emplace_back(0, v);
+            }
+        } else if (shape == TreeShape::CATERPILLAR) {
+            int spineLength = rnd_->nextInt(1, n);
+            for (int v = 1; v < spineLength; v++) {
+                edges.emplace_back(v - 1, v);
+            }
+            for (int v = spineLength; v < n; v++) {
+                edges.emplace_back(rnd_->nextInt(spineLength), v);
+            }
+        } else {
+            // Each vertex offers two child slots; a new vertex takes a random free slot.
+            vector<int> slots = {0, 0};
+            for (int v = 1; v < n; v++) {
+                int i = rnd_->nextInt((int) slots.size());
+                edges.emplace_back(slots[i], v);
+                slots[i] = slots.back();
+                slots.pop_back();
+                slots.push_back(v);
+                slots.push_back(v);
+            }
+        }
+        return edges;
+    }
+
+    // Linear-time Prufer decoding.
+    void buildPruferTree(int n, vector<pair<int, int>>& edges) {
+        if (n == 1) {
+            return;
+        }
+        vector<int> code = n > 2 ? rnd_->nextInts(n - 2, 0, n - 1) : vector<int>();
+        vector<int> degrees(n, 1);
+        for (int v : code) {
+            degrees[v]++;
+        }
+
+        int ptr = 0;
+        while (degrees[ptr] != 1) {
+            ptr++;
+        }
+        int leaf = ptr;
+        for (int v : code) {
+            edges.emplace_back(leaf, v);
+            if (--degrees[v] == 1 && v < ptr) {
+                leaf = v;
+            } else {
+                ptr++;
+                while (degrees[ptr] != 1) {
+                    ptr++;
+                }
+                leaf = ptr;
+            }
+        }
+        edges.emplace_back(leaf, n - 1);
+    }
+
+    void relabel(int n, vector<pair<int, int>>& edges) {
+        vector<int> labels(n);
+        for (int v = 0; v < n; v++) {
+            labels[v] = v;
+        }
+        rnd_->shuffle(labels.begin(), labels.end());
+        rnd_->shuffle(edges.begin(), edges.end());
+        for (pair<int, int>& edge : edges) {
+            edge.first = labels[edge.first];
+            edge.second = labels[edge.second];
+            if (rnd_->nextInt(2)) {
+                swap(edge.first, edge.second);
+            }
+        }
+    }
+
+    static void output(const vector<pair<int, int>>& edges, vector<int>& U, vector<int>& V, int firstVertex) {
+        U.resize(edges.size());
+        V.resize(edges.size());
+        for (size_t i = 0; i < edges.size(); i++) {
+            U[i] = edges[i].first + firstVertex;
+            V[i] = edges[i].second + firstVertex;
+        }
+    }
+
+    static long long key(int n, int u, int v) {
+        return u < v ? (long long) u * n + v : (long long) v * n + u;
+    }
+};
+
+}
@@ -1,22 +1,65 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <random>
+#include <string>
+#include <vector>
 
+#include "Xoshiro256.hpp"
+
+using std::distance;
+using std::iter_swap;
+using std::min;
 using std::mt19937;
-using std::random_shuffle;
+using std::string;
+using std::uint32_t;
+using std::uint64_t;
 using std::uniform_real_distribution;
 using std::uniform_int_distribution;
+using std::vector;
 
 namespace tcframe {
 
+enum class RandomEngine {
+    // std::mt19937 with the standard distributions; the default, for compatibility with existing test data.
+    MT19937,
+
+    // xoshiro256** with unbiased multiply-shift bounded generation; several times faster, and reproducible
+    // across standard libraries.
+    XOSHIRO256
+};
+
 class Random {
+public:
+    static const int BATCH_SIZE = 256;
+
+private:
+    RandomEngine engineType_ = RandomEngine::MT19937;
+    uint64_t seed_ = 0;
+    mt19937 engine;
+    Xoshiro256 fastEngine_;
+
 public:
     void setSeed(unsigned int seed) {
-        engine.seed(seed);
+        seedEngines(seed);
+    }
+
+    // Selects the engine and restarts it from the current seed.
+    void setEngine(RandomEngine engineType) {
+        engineType_ = engineType;
+        seedEngines(seed_);
+    }
+
+    RandomEngine engineType() const {
+        return engineType_;
     }
 
     int nextInt(int minNum, int maxNum) {
+        if (engineType_ == RandomEngine::XOSHIRO256) {
+            return (int) ((uint32_t) minNum + nextBounded32((uint32_t) maxNum - (uint32_t) minNum + 1));
+        }
         uniform_int_distribution<int> distr(minNum, maxNum);
         return distr(engine);
     }
@@ -26,6 +69,10 @@ public:
     }
 
     long long nextLongLong(long long minNum, long long maxNum) {
+        if (engineType_ == RandomEngine::XOSHIRO256) {
+            return (long long) ((uint64_t) minNum
+                    + nextBounded64((uint64_t) maxNum - (uint64_t) minNum + 1));
+        }
         uniform_int_distribution<long long> distr(minNum, maxNum);
         return distr(engine);
     }
@@ -35,6 +82,9 @@ public:
     }
 
     double nextDouble(double minNum, double maxNum) {
+        if (engineType_ == RandomEngine::XOSHIRO256) {
+            return minNum + (double) (fastEngine_() >> 11) / (double) (1ULL << 53) * (maxNum - minNum);
+        }
         uniform_real_distribution<double> distr(minNum, maxNum);
         return distr(engine);
     }
@@ -43,13 +93,257 @@ public:
         return nextDouble(0, maxNum);
     }
 
+    // Fisher-Yates shuffle. It draws the same numbers as the std::random_shuffle() it replaces, so
+    // existing test data is unchanged.
     template<typename RandomAccessIterator>
     void shuffle(RandomAccessIterator first, RandomAccessIterator last) {
-        random_shuffle(first, last, [this](unsigned int idx) { return nextInt(idx); });
+        if (first == last) {
+            return;
+        }
+        for (RandomAccessIterator i = first + 1; i != last; ++i) {
+            RandomAccessIterator j = first + nextInt((int) (i - first) + 1);
+            if (i != j) {
+                iter_swap(i, j);
+            }
+        }
+    }
+
+    // The bulk methods below produce exactly the values of the corresponding next*() method called once
+    // per element, but generate them in batches.
+
+    template<typename RandomAccessIterator>
+    void fillInts(RandomAccessIterator first, RandomAccessIterator last, int minNum, int maxNum) {
+        if (engineType_ != RandomEngine::XOSHIRO256) {
+            uniform_int_distribution<int> distr(minNum, maxNum);
+            for (; first != last; ++first) {
+                *first = distr(engine);
+            }
+            return;
+        }
+
+        uint32_t range = (uint32_t) maxNum - (uint32_t) minNum + 1;
+        uint32_t batch[BATCH_SIZE];
+        for (long long remaining = distance(first, last); remaining > 0; remaining -= BATCH_SIZE) {
+            int count = (int) min(remaining, (long long) BATCH_SIZE);
+            nextBoundedBatch32(batch, count, range);
+            for (int k = 0; k < count; k++) {
+                *first++ = (int) ((uint32_t) minNum + batch[k]);
+            }
+        }
+    }
+
+    template<typename RandomAccessIterator>
+    void fillLongLongs(RandomAccessIterator first, RandomAccessIterator last, long long minNum, long long maxNum) {
+        if (engineType_ != RandomEngine::XOSHIRO256) {
+            uniform_int_distribution<long long> distr(minNum, maxNum);
+            for (; first != last; ++first) {
+                *first = distr(engine);
+            }
+            return;
+        }
+
+        uint64_t range = (uint64_t) maxNum - (uint64_t) minNum + 1;
+        uint64_t batch[BATCH_SIZE];
+        for (long long remaining = distance(first, last); remaining > 0; remaining -= BATCH_SIZE) {
+            int count = (int) min(remaining, (long long) BATCH_SIZE);
+            nextBoundedBatch64(batch, count, range);
+            for (int k = 0; k < count; k++) {
+                *first++ = (long long) ((uint64_t) minNum + batch[k]);
+            }
+        }
+    }
+
+    template<typename RandomAccessIterator>
+    void fillDoubles(RandomAccessIterator first, RandomAccessIterator last, double minNum, double maxNum) {
+        if (engineType_ != RandomEngine::XOSHIRO256) {
+            uniform_real_distribution<double> distr(minNum, maxNum);
+            for (; first != last; ++first) {
+                *first = distr(engine);
+            }
+            return;
+        }
+
+        uint64_t batch[BATCH_SIZE];
+        for (long long remaining = distance(first, last); remaining > 0; remaining -= BATCH_SIZE) {
+            int count = (int) min(remaining, (long long) BATCH_SIZE);
+            for (int k = 0; k < count; k++) {
+                batch[k] = fastEngine_();
+            }
+            for (int k = 0; k < count; k++) {
+                *first++ = minNum + (double) (batch[k] >> 11) / (double) (1ULL << 53) * (maxNum - minNum);
+            }
+        }
+    }
+
+    vector<int> nextInts(int size, int minNum, int maxNum) {
+        vector<int> result(size);
+        fillInts(result.begin(), result.end(), minNum, maxNum);
+        return result;
+    }
+
+    vector<long long> nextLongLongs(int size, long long minNum, long long maxNum) {
+        vector<long long> result(size);
+        fillLongLongs(result.begin(), result.end(), minNum, maxNum);
+        return result;
+    }
+
+    vector<double> nextDoubles(int size, double minNum, double maxNum) {
+        vector<double> result(size);
+        fillDoubles(result.begin(), result.end(), minNum, maxNum);
+        return result;
+    }
+
+    // Each character is picked uniformly from the alphabet.
+    string nextString(int length, const string& alphabet) {
+        vector<int> indices = nextInts(length, 0, (int) alphabet.size() - 1);
+        string result(length, ' ');
+        for (int i = 0; i < length; i++) {
+            result[i] = alphabet[indices[i]];
+        }
+        return result;
+    }
+
+    // Each cell is independently filled with probability density, i.e. when nextDouble(0, 1) < density.
+    vector<vector<char>> nextGrid(int rows, int columns, double density, char filled = '#', char empty = '.') {
+        vector<vector<char>> result(rows, vector<char>(columns));
+        vector<double> values(columns);
+        for (int r = 0; r < rows; r++) {
+            fillDoubles(values.begin(), values.end(), 0.0, 1.0);
+            for (int c = 0; c < columns; c++) {
+                result[r][c] = values[c] < density ? filled : empty;
+            }
+        }
+        return result;
+    }
+
+    // Returns an independent stream with the same engine, seeded from this one's next output, which
+    // advances this stream.
+    Random split() {
+        uint64_t seed = engineType_ == RandomEngine::XOSHIRO256 ? fastEngine_() : engine();
+        return derive(seed);
+    }
+
+    // Returns an independent stream with the same engine, determined only by this stream's seed and
+    // the key, regardless of how many values have been drawn from this stream.
+    Random fork(uint64_t key) const {
+        uint64_t x = seed_ ^ Xoshiro256::splitMix64(key);
+        return derive(Xoshiro256::splitMix64(x));
     }
 
 private:
-    mt19937 engine;
+    void seedEngines(uint64_t seed) {
+        seed_ = seed;
+        engine.seed((unsigned int) (seed ^ (seed >> 32)));
+        fastEngine_.seed(seed);
+    }
+
+    Random derive(uint64_t seed) const {
+        Random child;
+        child.engineType_ = engineType_;
+        child.seedEngines(seed);
+        return child;
+    }
+
+    // Uniform in [0, range), where range = 0 means 2^32. Lemire's multiply-shift with rejection.
+    uint32_t nextBounded32(uint32_t range) {
+        if (range == 0) {
+            return (uint32_t) (fastEngine_() >> 32);
+        }
+        uint64_t m = (fastEngine_() >> 32) * range;
+        if ((uint32_t) m < range) {
+            uint32_t threshold = (uint32_t) -range % range;
+            while ((uint32_t) m < threshold) {
+                m = (fastEngine_() >> 32) * range;
+            }
+        }
+        return (uint32_t) (m >> 32);
+    }
+
+    // Same as count calls of nextBounded32(). The multiply-shift step runs over the whole batch, and the
+    // batch is only replayed one by one when some value needs rejection, which is rare.
+    void nextBoundedBatch32(uint32_t* out, int count, uint32_t range) {
+        uint64_t raws[BATCH_SIZE];
+        for (int k = 0; k < count; k++) {
+            raws[k] = fastEngine_();
+        }
+        if (range == 0) {
+            for (int k = 0; k < count; k++) {
+                out[k] = (uint32_t) (raws[k] >> 32);
+            }
+            return;
+        }
+
+        uint32_t threshold = (uint32_t) -range % range;
+        bool isRejected = false;
+        for (int k = 0; k < count; k++) {
+            uint64_t m = (raws[k] >> 32) * range;
+            out[k] = (uint32_t) (m >> 32);
+            isRejected |= (uint32_t) m < threshold;
+        }
+        if (!isRejected) {
+            return;
+        }
+
+        int next = 0;
+        for (int k = 0; k < count; k++) {
+            uint64_t m;
+            do {
+                uint64_t raw = next < count ? raws[next++] : fastEngine_();
+                m = (raw >> 32) * range;
+            } while ((uint32_t) m < threshold);
+            out[k] = (uint32_t) (m >> 32);
+        }
+    }
+
+    // Same as count calls of nextBounded64().
+    void nextBoundedBatch64(uint64_t* out, int count, uint64_t range) {
+        uint64_t raws[BATCH_SIZE];
+        for (int k = 0; k < count; k++) {
+            raws[k] = fastEngine_();
+        }
+        if (range == 0) {
+            for (int k = 0; k < count; k++) {
+                out[k] = raws[k];
+            }
+            return;
+        }
+
+        uint64_t threshold = -range % range;
+        bool isRejected = false;
+        for (int k = 0; k < count; k++) {
+            unsigned __int128 m = (unsigned __int128) raws[k] * range;
+            out[k] = (uint64_t) (m >> 64);
+            isRejected |= (uint64_t) m < threshold;
+        }
+        if (!isRejected) {
+            return;
+        }
+
+        int next = 0;
+        for (int k = 0; k < count; k++) {
+            unsigned __int128 m;
+            do {
+                uint64_t raw = next < count ? raws[next++] : fastEngine_();
+                m = (unsigned __int128) raw * range;
+            } while ((uint64_t) m < threshold);
+            out[k] = (uint64_t) (m >> 64);
+        }
+    }
+
+    // Uniform in [0, range), where range = 0 means 2^64.
+    uint64_t nextBounded64(uint64_t range) {
+        if (range == 0) {
+            return fastEngine_();
+        }
+        unsigned __int128 m = (unsigned __int128) fastEngine_() * range;
+        if ((uint64_t) m < range) {
+            uint64_t threshold = -range % range;
+            while ((uint64_t) m < threshold) {
+                m = (unsigned __int128) fastEngine_() * range;
+            }
+        }
+        return (uint64_t) (m >> 64);
+    }
 };
 
 }
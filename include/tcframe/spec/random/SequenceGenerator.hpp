@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "Random.hpp"
+#include "tcframe/util.hpp"
+
+using std::runtime_error;
+using std::sort;
+using std::unordered_set;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Generates random permutations, samples, and compositions in (expected) linear time, or O(k log k)
+ * where the result is sorted.
+ */
+class SequenceGenerator {
+private:
+    Random* rnd_;
+
+public:
+    explicit SequenceGenerator(Random* rnd)
+            : rnd_(rnd) {}
+
+    // A uniformly random permutation of first, first + 1, ..., first + n - 1.
+    vector<int> nextPermutation(int n, int first = 1) {
+        vector<int> result(n);
+        for (int i = 0; i < n; i++) {
+            result[i] = first + i;
+        }
+        rnd_->shuffle(result.begin(), result.end());
+        return result;
+    }
+
+    // k distinct values chosen uniformly from [minNum, maxNum], in increasing order. Uses Floyd's
+    // algorithm, so the range can be much larger than k.
+    vector<long long> nextDistinct(int k, long long minNum, long long maxNum) {
+        long long n = maxNum - minNum + 1;
+        if (k < 0 || k > n) {
+            throw runtime_error("Cannot choose " + StringUtils::toString(k) + " distinct values from "
+                    + StringUtils::toString(n) + " values");
+        }
+
+        unordered_set<long long> chosen;
+        chosen.reserve(k);
+        for (long long j = n - k; j < n; j++) {
+            long long t = rnd_->nextLongLong(0, j);
+            chosen.insert(chosen.count(t) ? j : t);
+        }
+
+        vector<long long> result;
+        result.reserve(k);
+        for (long long t : chosen) {
+            result.push_back(minNum + t);
+        }
+        sort(result.begin(), result.end());
+        return result;
+    }
+
+    // A uniformly random composition of sum into the given number of ordered parts, each at least minPart.
+    vector<long long> nextComposition(long long sum, int parts, long long minPart = 1) {
+        if (parts < 1 || sum < parts * minPart) {
+            throw runtime_error("Cannot split " + StringUtils::toString(sum) + " into "
+                    + StringUtils::toString(parts) + " parts of at least " + StringUtils::toString(minPart));
+        }
+
+        // Cut [0, shifted) at parts - 1 distinct positions, so that each part is positive.
+        long long shifted = sum - parts * (minPart - 1);
+        vector<long long> cuts = nextDistinct(parts - 1, 1, shifted - 1);
+        cuts.push_back(shifted);
+
+        vector<long long> result(parts);
+        long long previous = 0;
+        for (int i = 0; i < parts; i++) {
+            result[i] = cuts[i] - previous + (minPart - 1);
+            previous = cuts[i];
+        }
+        return result;
+    }
+};
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+using std::uint64_t;
+
+namespace tcframe {
+
+/*
+ * The xoshiro256** generator by Blackman and Vigna: 32 bytes of state, 64-bit outputs, and a period
+ * of 2^256 - 1. It is seeded through splitmix64, as recommended by its authors. It satisfies the
+ * UniformRandomBitGenerator requirements, and its output only depends on the seed, not on the
+ * standard library.
+ */
+class Xoshiro256 {
+public:
+    typedef uint64_t result_type;
+
+private:
+    uint64_t s_[4];
+
+public:
+    explicit Xoshiro256(uint64_t seed = 0) {
+        this->seed(seed);
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return ~(result_type) 0;
+    }
+
+    void seed(uint64_t seed) {
+        for (uint64_t& s : s_) {
+            s = splitMix64(seed);
+        }
+    }
+
+    result_type operator()() {
+        uint64_t result = rotl(s_[1] * 5, 7) * 9;
+        uint64_t t = s_[1] << 17;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = rotl(s_[3], 45);
+        return result;
+    }
+
+    // Advances x by one splitmix64 step and returns the mixed value.
+    static uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <set>
 #include <string>
 #include <tuple>
@@ -8,8 +9,10 @@
 #include "TestCaseData.hpp"
 #include "tcframe/util.hpp"
 
+using std::make_shared;
 using std::move;
 using std::set;
+using std::shared_ptr;
 using std::string;
 using std::tie;
 
@@ -21,7 +24,7 @@ struct TestCase {
 private:
     string name_;
     optional<string> description_;
-    set<int> subtaskIds_;
+    shared_ptr<const set<int>> subtaskIds_ = noSubtaskIds();
     TestCaseData* data_;
 
 public:
@@ -34,6 +37,11 @@ public:
     }
 
     const set<int>& subtaskIds() const {
+        return *subtaskIds_;
+    }
+
+    // The subtask ids may be shared with other test cases, e.g. all test cases in a test group.
+    const shared_ptr<const set<int>>& sharedSubtaskIds() const {
         return subtaskIds_;
     }
 
@@ -42,7 +50,7 @@ public:
     }
 
     bool operator==(const TestCase& o) const {
-        if (tie(name_, description_, subtaskIds_) != tie(o.name_, o.description_, o.subtaskIds_)) {
+        if (tie(name_, description_, *subtaskIds_) != tie(o.name_, o.description_, *o.subtaskIds_)) {
             return false;
         }
         if ((data_ == nullptr) != (o.data_ == nullptr)) {
@@ -54,6 +62,12 @@ public:
     static string createName(const string& testGroupName, int testCaseId) {
         return testGroupName + "_" + StringUtils::toString(testCaseId);
     }
+
+private:
+    static const shared_ptr<const set<int>>& noSubtaskIds() {
+        static const shared_ptr<const set<int>> subtaskIds = make_shared<const set<int>>();
+        return subtaskIds;
+    }
 };
 
 class TestCaseBuilder {
@@ -72,6 +86,11 @@ public:
     }
 
     TestCaseBuilder& setSubtaskIds(set<int> subtaskIds) {
+        subject_.subtaskIds_ = make_shared<const set<int>>(move(subtaskIds));
+        return *this;
+    }
+
+    TestCaseBuilder& setSharedSubtaskIds(shared_ptr<const set<int>> subtaskIds) {
         subject_.subtaskIds_ = move(subtaskIds);
         return *this;
     }
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <map>
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -18,10 +20,13 @@
 
 using std::inserter;
 using std::function;
+using std::make_shared;
+using std::map;
 using std::move;
 using std::runtime_error;
 using std::set;
 using std::set_difference;
+using std::shared_ptr;
 using std::string;
 using std::tie;
 using std::vector;
@@ -58,6 +63,10 @@ private:
 
     set<int>* curSubtaskIds_ = nullptr;
 
+    // Test cases with equal subtask ids share a single copy of them.
+    map<set<int>, shared_ptr<const set<int>>> internedSubtaskIds_;
+    shared_ptr<const set<int>> curOfficialInternedSubtaskIds_;
+
     int curOfficialTestGroupId_ = TestGroup::MAIN_ID;
     bool hasCurOfficialTestGroup_ = false;
     set<int> curOfficialSubtaskIds_ = {Subtask::MAIN_ID};
@@ -154,11 +163,15 @@ public:
         // Note: GCC will be angry at you if the parameter name is "closure".
         // https://bugs.archlinux.org/task/35803
 
+        if (!curOfficialInternedSubtaskIds_ || *curOfficialInternedSubtaskIds_ != curOfficialSubtaskIds_) {
+            curOfficialInternedSubtaskIds_ = intern(curOfficialSubtaskIds_);
+        }
+
         curOfficialTestCases_.push_back(TestCaseBuilder()
                 .setName(TestCase::createName(
                         TestGroup::createName(slug_, curOfficialTestGroupId_),
                         (int) curOfficialTestCases_.size() + 1))
-                .setSubtaskIds(curOfficialSubtaskIds_)
+                .setSharedSubtaskIds(curOfficialInternedSubtaskIds_)
                 .setDescription(move(description))
                 .setData(new OfficialTestCaseData([=]{
                     beforeClosure_();
@@ -178,12 +191,15 @@ public:
         }
 
         vector<TestGroup> testGroups;
-        testGroups.emplace_back(TestGroup::SAMPLE_ID, curSampleTestCases_);
-        for (auto testGroup : curOfficialTestGroups_) {
-            testGroups.push_back(testGroup);
+        testGroups.reserve(curOfficialTestGroups_.size() + 1);
+        testGroups.emplace_back(TestGroup::SAMPLE_ID, move(curSampleTestCases_));
+        for (TestGroup& testGroup : curOfficialTestGroups_) {
+            testGroups.push_back(move(testGroup));
         }
+        curSampleTestCases_.clear();
+        curOfficialTestGroups_.clear();
 
-        return TestSuite(testGroups);
+        return TestSuite(move(testGroups));
     }
 
 private:
@@ -213,13 +229,22 @@ private:
                 .setName(TestCase::createName(
                         TestGroup::createName(slug_, TestGroup::SAMPLE_ID),
                         (int) curSampleTestCases_.size() + 1))
-                .setSubtaskIds(curSampleSubtaskIds_)
+                .setSharedSubtaskIds(intern(curSampleSubtaskIds_))
                 .setData(data)
                 .build());
     }
 
     void addCurrentOfficialTestGroup() {
-        curOfficialTestGroups_.emplace_back(curOfficialTestGroupId_, curOfficialTestCases_);
+        curOfficialTestGroups_.emplace_back(curOfficialTestGroupId_, move(curOfficialTestCases_));
+        curOfficialTestCases_.clear();
+    }
+
+    shared_ptr<const set<int>> intern(const set<int>& subtaskIds) {
+        shared_ptr<const set<int>>& interned = internedSubtaskIds_[subtaskIds];
+        if (!interned) {
+            interned = make_shared<const set<int>>(subtaskIds);
+        }
+        return interned;
     }
 };
 
@@ -1,7 +1,13 @@
 #pragma once
 
+#include "tcframe/spec/variable/BitGrid.hpp"
+#include "tcframe/spec/variable/CharRowParser.hpp"
+#include "tcframe/spec/variable/Grid.hpp"
+#include "tcframe/spec/variable/IntegerParser.hpp"
 #include "tcframe/spec/variable/Matrix.hpp"
 #include "tcframe/spec/variable/Scalar.hpp"
+#include "tcframe/spec/variable/StreamedVector.hpp"
+#include "tcframe/spec/variable/TokenContext.hpp"
 #include "tcframe/spec/variable/TokenFormatter.hpp"
 #include "tcframe/spec/variable/Variable.hpp"
 #include "tcframe/spec/variable/Vector.hpp"
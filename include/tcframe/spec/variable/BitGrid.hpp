@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using std::runtime_error;
+using std::size_t;
+using std::uint64_t;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Boolean grid packed into 64-bit words, one bit per cell. In I/O, a cell is printed/parsed as one of
+ * two characters (by default '0' and '1'), without spaces. Each row starts at a new word, and the
+ * unused bits of a row's last word are always zero, so that whole rows can be checked word by word.
+ */
+class BitGrid {
+public:
+    static const int WORD_BITS = 64;
+
+private:
+    char offChar_;
+    char onChar_;
+    int rows_;
+    int columns_;
+    int wordsPerRow_;
+    vector<uint64_t> words_;
+
+public:
+    explicit BitGrid(char offChar = '0', char onChar = '1')
+            : offChar_(offChar)
+            , onChar_(onChar)
+            , rows_(0)
+            , columns_(0)
+            , wordsPerRow_(0) {}
+
+    char offChar() const {
+        return offChar_;
+    }
+
+    char onChar() const {
+        return onChar_;
+    }
+
+    int rows() const {
+        return rows_;
+    }
+
+    int columns() const {
+        return columns_;
+    }
+
+    int wordsPerRow() const {
+        return wordsPerRow_;
+    }
+
+    const vector<uint64_t>& words() const {
+        return words_;
+    }
+
+    void assign(int rows, int columns, bool value = false) {
+        rows_ = rows;
+        columns_ = columns;
+        wordsPerRow_ = (columns + WORD_BITS - 1) / WORD_BITS;
+        words_.assign((size_t) rows * wordsPerRow_, 0);
+        if (value) {
+            for (int r = 0; r < rows; r++) {
+                fillRow(r);
+            }
+        }
+    }
+
+    void clear() {
+        assign(0, 0);
+    }
+
+    void addRow(const vector<bool>& row) {
+        if (rows_ == 0) {
+            columns_ = (int) row.size();
+            wordsPerRow_ = (columns_ + WORD_BITS - 1) / WORD_BITS;
+        } else if ((int) row.size() != columns_) {
+            throw runtime_error("Grid rows must have the same number of columns");
+        }
+        words_.resize(words_.size() + wordsPerRow_, 0);
+        rows_++;
+        for (int c = 0; c < columns_; c++) {
+            set(rows_ - 1, c, row[c]);
+        }
+    }
+
+    bool get(int row, int column) const {
+        return (words_[wordIndex(row, column)] >> (column % WORD_BITS)) & 1;
+    }
+
+    void set(int row, int column, bool value) {
+        uint64_t bit = (uint64_t) 1 << (column % WORD_BITS);
+        if (value) {
+            words_[wordIndex(row, column)] |= bit;
+        } else {
+            words_[wordIndex(row, column)] &= ~bit;
+        }
+    }
+
+    long long count() const {
+        long long result = 0;
+        for (uint64_t word : words_) {
+            result += __builtin_popcountll(word);
+        }
+        return result;
+    }
+
+    int countRow(int row) const {
+        int result = 0;
+        for (int w = 0; w < wordsPerRow_; w++) {
+            result += __builtin_popcountll(words_[(size_t) row * wordsPerRow_ + w]);
+        }
+        return result;
+    }
+
+    bool isRowAll(int row, bool value) const {
+        for (int w = 0; w < wordsPerRow_; w++) {
+            uint64_t expected = value ? wordMask(w) : 0;
+            if (words_[(size_t) row * wordsPerRow_ + w] != expected) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isColumnAll(int column, bool value) const {
+        for (int r = 0; r < rows_; r++) {
+            if (get(r, column) != value) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isBorderAll(bool value) const {
+        if (rows_ == 0 || columns_ == 0) {
+            return true;
+        }
+        return isRowAll(0, value) && isRowAll(rows_ - 1, value)
+               && isColumnAll(0, value) && isColumnAll(columns_ - 1, value);
+    }
+
+    bool operator==(const BitGrid& o) const {
+        return rows_ == o.rows_ && columns_ == o.columns_ && words_ == o.words_;
+    }
+
+    bool operator!=(const BitGrid& o) const {
+        return !(*this == o);
+    }
+
+private:
+    size_t wordIndex(int row, int column) const {
+        return (size_t) row * wordsPerRow_ + column / WORD_BITS;
+    }
+
+    uint64_t wordMask(int word) const {
+        int bits = columns_ - word * WORD_BITS;
+        return bits >= WORD_BITS ? ~(uint64_t) 0 : ((uint64_t) 1 << bits) - 1;
+    }
+
+    void fillRow(int row) {
+        for (int w = 0; w < wordsPerRow_; w++) {
+            words_[(size_t) row * wordsPerRow_ + w] = wordMask(w);
+        }
+    }
+};
+
+}
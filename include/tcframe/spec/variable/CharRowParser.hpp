@@ -0,0 +1,46 @@
+#pragma once
+
+#include <ios>
+#include <iostream>
+#include <streambuf>
+
+using std::ios;
+using std::istream;
+using std::streamsize;
+
+namespace tcframe {
+
+/*
+ * Reads a whole row of a char matrix (which has no separating spaces) from the stream buffer at
+ * once. If the row is incomplete or contains a character that might be whitespace, it seeks back
+ * and returns false, so that the caller can fall back to parsing element by element and report the
+ * precise error.
+ */
+class CharRowParser {
+public:
+    CharRowParser() = delete;
+
+    static bool tryParse(istream* in, char* row, int columns) {
+        if (!in->good() || columns <= 0) {
+            return false;
+        }
+
+        streamsize count = in->rdbuf()->sgetn(row, columns);
+
+        // All whitespace characters are at most ' '; this loop is branch-free so that it vectorizes.
+        bool suspicious = false;
+        for (streamsize c = 0; c < count; c++) {
+            suspicious |= (unsigned char) row[c] <= ' ';
+        }
+
+        if (count < columns || suspicious) {
+            if (count > 0) {
+                in->seekg(-count, ios::cur);
+            }
+            return false;
+        }
+        return true;
+    }
+};
+
+}
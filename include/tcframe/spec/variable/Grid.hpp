@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using std::ptrdiff_t;
+using std::runtime_error;
+using std::size_t;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Two-dimensional container with a fixed number of columns, whose elements are stored contiguously
+ * in row-major order. It can be used in place of vector<vector<T>> as a grid variable:
+ * G[r][c] accesses an element, and begin()/end() iterate over all elements.
+ */
+template<typename T>
+class Grid {
+public:
+    using iterator = typename vector<T>::iterator;
+    using const_iterator = typename vector<T>::const_iterator;
+
+private:
+    int rows_;
+    int columns_;
+    vector<T> elements_;
+
+public:
+    Grid()
+            : rows_(0)
+            , columns_(0) {}
+
+    Grid(int rows, int columns, const T& value = T())
+            : rows_(rows)
+            , columns_(columns)
+            , elements_((size_t) rows * columns, value) {}
+
+    int rows() const {
+        return rows_;
+    }
+
+    int columns() const {
+        return columns_;
+    }
+
+    bool empty() const {
+        return elements_.empty();
+    }
+
+    void assign(int rows, int columns, const T& value = T()) {
+        rows_ = rows;
+        columns_ = columns;
+        elements_.assign((size_t) rows * columns, value);
+    }
+
+    void clear() {
+        rows_ = 0;
+        columns_ = 0;
+        elements_.clear();
+    }
+
+    void addRow(const vector<T>& row) {
+        if (rows_ == 0) {
+            columns_ = (int) row.size();
+        } else if ((int) row.size() != columns_) {
+            throw runtime_error("Grid rows must have the same number of columns");
+        }
+        elements_.insert(elements_.end(), row.begin(), row.end());
+        rows_++;
+    }
+
+    iterator operator[](int row) {
+        return elements_.begin() + (ptrdiff_t) row * columns_;
+    }
+
+    const_iterator operator[](int row) const {
+        return elements_.begin() + (ptrdiff_t) row * columns_;
+    }
+
+    iterator begin() {
+        return elements_.begin();
+    }
+
+    iterator end() {
+        return elements_.end();
+    }
+
+    const_iterator begin() const {
+        return elements_.begin();
+    }
+
+    const_iterator end() const {
+        return elements_.end();
+    }
+
+    const vector<T>& elements() const {
+        return elements_;
+    }
+
+    bool operator==(const Grid<T>& o) const {
+        return rows_ == o.rows_ && columns_ == o.columns_ && elements_ == o.elements_;
+    }
+
+    bool operator!=(const Grid<T>& o) const {
+        return !(*this == o);
+    }
+};
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <ios>
+#include <iostream>
+#include <limits>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+
+using std::char_traits;
+using std::false_type;
+using std::integral_constant;
+using std::ios;
+using std::is_integral;
+using std::is_signed;
+using std::istream;
+using std::make_unsigned;
+using std::numeric_limits;
+using std::streambuf;
+using std::streamoff;
+using std::true_type;
+
+namespace tcframe {
+
+/*
+ * Parses a decimal integer directly from the stream buffer, skipping the sentry, locale, and
+ * position bookkeeping of operator>>. It only succeeds on input that operator>> would accept as is;
+ * otherwise (e.g. no digits, or out of range), it seeks back to where it started and returns false,
+ * so that the caller can fall back to operator>> and report the usual error.
+ */
+class IntegerParser {
+public:
+    IntegerParser() = delete;
+
+    template<typename T>
+    static bool tryParse(istream* in, T& var) {
+        // Character types are excluded as operator>> reads them as single characters, and unsigned
+        // types as operator>> accepts (and wraps) negative values for them.
+        return tryParse(in, var, integral_constant<bool,
+                is_integral<T>::value && is_signed<T>::value && (sizeof(T) > 1)>());
+    }
+
+private:
+    template<typename T>
+    static bool tryParse(istream*, T&, false_type) {
+        return false;
+    }
+
+    template<typename T>
+    static bool tryParse(istream* in, T& var, true_type) {
+        if (!in->good()) {
+            return false;
+        }
+
+        streambuf* buf = in->rdbuf();
+        int c = buf->sgetc();
+        streamoff consumed = 0;
+
+        bool negative = false;
+        if (c == '-' || c == '+') {
+            negative = c == '-';
+            c = buf->snextc();
+            consumed++;
+        }
+        if (c < '0' || c > '9') {
+            rewind(in, consumed);
+            return false;
+        }
+
+        using U = typename make_unsigned<T>::type;
+        U limit = negative ? (U) numeric_limits<T>::max() + 1 : (U) numeric_limits<T>::max();
+        U value = 0;
+        while (c >= '0' && c <= '9') {
+            U digit = (U) (c - '0');
+            if (value > (limit - digit) / 10) {
+                rewind(in, consumed);
+                return false;
+            }
+            value = value * 10 + digit;
+            c = buf->snextc();
+            consumed++;
+        }
+        if (c == char_traits<char>::eof()) {
+            in->setstate(ios::eofbit);
+        }
+
+        var = negative ? (T) (0 - value) : (T) value;
+        return true;
+    }
+
+    static void rewind(istream* in, streamoff consumed) {
+        if (consumed > 0) {
+            in->seekg(-consumed, ios::cur);
+        }
+    }
+};
+
+}
@@ -3,16 +3,22 @@
 #include <exception>
 #include <iostream>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
-#include "TokenFormatter.hpp"
+#include "BitGrid.hpp"
+#include "CharRowParser.hpp"
+#include "Grid.hpp"
+#include "TokenContext.hpp"
 #include "Variable.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::endl;
+using std::false_type;
 using std::iostream;
 using std::is_same;
 using std::ostream;
+using std::true_type;
 using std::vector;
 
 namespace tcframe {
@@ -29,11 +35,19 @@ public:
     virtual void clear() = 0;
     virtual void printTo(ostream* out) = 0;
     virtual void printRowTo(int rowIndex, ostream* out) = 0;
+    virtual void resize(int rows, int columns) = 0;
     virtual void parseFrom(istream* in, int rows, int columns) = 0;
+    virtual void parseRowsFrom(istream* in, int begin, int end, int columns) = 0;
     virtual void parseAndAddRowFrom(istream* in, int rowIndex) = 0;
 
     template<typename T, typename = ScalarCompatible<T>>
     static Matrix* create(vector<vector<T>>& var, string name);
+
+    template<typename T, typename = ScalarCompatible<T>>
+    static Matrix* create(Grid<T>& var, string name);
+
+    template<typename = void>
+    static Matrix* create(BitGrid& var, string name);
 };
 
 template<typename T, typename = ScalarCompatible<T>>
@@ -64,33 +78,28 @@ public:
 
     void printTo(ostream* out) {
         for (int row = 0; row < var_->size(); row++) {
-            printRowTo(row, out);
+            MatrixImpl::printRowTo(row, out);
             *out << endl;
         }
     }
 
     void printRowTo(int rowIndex, ostream* out) {
-        for (int c = 0; c < (*var_)[rowIndex].size(); c++) {
-            if (c > 0 && hasSpaces_) {
-                *out << ' ';
-            }
-            *out << (*var_)[rowIndex][c];
-        }
+        printRow((*var_)[rowIndex], out, is_same<T, char>());
+    }
+
+    void resize(int rows, int) {
+        var_->assign(rows, vector<T>());
     }
 
     void parseFrom(istream* in, int rows, int columns) {
-        for (int r = 0; r < rows; r++) {
-            vector<T> row;
-            for (int c = 0; c < columns; c++) {
-                if (c > 0 && hasSpaces_) {
-                    WhitespaceManipulator::parseSpace(in, TokenFormatter::formatMatrixElement(name(), r, c - 1));
-                }
-                T element;
-                Variable::parseValue(in, element, TokenFormatter::formatMatrixElement(name(), r, c));
-                row.push_back(element);
-            }
-            var_->push_back(row);
-            WhitespaceManipulator::parseNewline(in, TokenFormatter::formatMatrixElement(name(), r, columns - 1));
+        MatrixImpl::resize(rows, columns);
+        MatrixImpl::parseRowsFrom(in, 0, rows, columns);
+    }
+
+    void parseRowsFrom(istream* in, int begin, int end, int columns) {
+        for (int r = begin; r < end; r++) {
+            parseRow(in, (*var_)[r], r, columns, is_same<T, char>());
+            WhitespaceManipulator::parseNewline(in, TokenContext::matrixElement(name(), r, columns - 1));
         }
     }
 
@@ -101,14 +110,251 @@ public:
             if (c > 0 && hasSpaces_) {
                 WhitespaceManipulator::parseSpaceAfterMissingNewline(
                         in,
-                        TokenFormatter::formatMatrixElement(name(), rowIndex, c - 1));
+                        TokenContext::matrixElement(name(), rowIndex, c - 1));
             }
             T element;
-            Variable::parseValue(in, element, TokenFormatter::formatMatrixElement(name(), rowIndex, c));
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
             row.push_back(element);
         }
         var_->push_back(row);
     }
+
+private:
+    void printRow(const vector<T>& row, ostream* out, true_type) {
+        out->write(row.data(), row.size());
+    }
+
+    void printRow(const vector<T>& row, ostream* out, false_type) {
+        for (int c = 0; c < row.size(); c++) {
+            if (c > 0 && hasSpaces_) {
+                *out << ' ';
+            }
+            *out << row[c];
+        }
+    }
+
+    void parseRow(istream* in, vector<T>& row, int rowIndex, int columns, true_type) {
+        row.resize(columns);
+        if (CharRowParser::tryParse(in, row.data(), columns)) {
+            return;
+        }
+        row.clear();
+        parseRow(in, row, rowIndex, columns, false_type());
+    }
+
+    void parseRow(istream* in, vector<T>& row, int rowIndex, int columns, false_type) {
+        row.reserve(columns);
+        for (int c = 0; c < columns; c++) {
+            if (c > 0 && hasSpaces_) {
+                WhitespaceManipulator::parseSpace(in, TokenContext::matrixElement(name(), rowIndex, c - 1));
+            }
+            T element;
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+            row.push_back(element);
+        }
+    }
+};
+
+template<typename T, typename = ScalarCompatible<T>>
+class GridImpl : public Matrix {
+private:
+    Grid<T>* var_;
+    bool hasSpaces_;
+
+public:
+    virtual ~GridImpl() = default;
+
+    GridImpl(Grid<T>& var, string name)
+            : Matrix(name)
+            , var_(&var)
+            , hasSpaces_(!is_same<T, char>::value) {}
+
+    int rows() const {
+        return var_->rows();
+    }
+
+    int columns(int) const {
+        return var_->columns();
+    }
+
+    void clear() {
+        var_->clear();
+    }
+
+    // Grid<bool> is a single vector<bool>, whose neighbouring rows share words.
+    bool canParseConcurrently() const {
+        return !is_same<T, bool>::value;
+    }
+
+    void printTo(ostream* out) {
+        for (int row = 0; row < var_->rows(); row++) {
+            GridImpl::printRowTo(row, out);
+            *out << endl;
+        }
+    }
+
+    void printRowTo(int rowIndex, ostream* out) {
+        printRow((*var_)[rowIndex], out, is_same<T, char>());
+    }
+
+    void resize(int rows, int columns) {
+        var_->assign(rows, columns);
+    }
+
+    void parseFrom(istream* in, int rows, int columns) {
+        GridImpl::resize(rows, columns);
+        GridImpl::parseRowsFrom(in, 0, rows, columns);
+    }
+
+    void parseRowsFrom(istream* in, int begin, int end, int columns) {
+        for (int r = begin; r < end; r++) {
+            parseRow(in, (*var_)[r], r, columns, is_same<T, char>());
+            WhitespaceManipulator::parseNewline(in, TokenContext::matrixElement(name(), r, columns - 1));
+        }
+    }
+
+    void parseAndAddRowFrom(istream* in, int rowIndex) {
+        vector<T> row;
+        for (int c = 0; !WhitespaceManipulator::canParseNewline(in); c++) {
+            if (c > 0 && hasSpaces_) {
+                WhitespaceManipulator::parseSpaceAfterMissingNewline(
+                        in,
+                        TokenContext::matrixElement(name(), rowIndex, c - 1));
+            }
+            T element;
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+            row.push_back(element);
+        }
+        var_->addRow(row);
+    }
+
+private:
+    void printRow(typename Grid<T>::iterator row, ostream* out, true_type) {
+        if (var_->columns() > 0) {
+            out->write(&*row, var_->columns());
+        }
+    }
+
+    void printRow(typename Grid<T>::iterator row, ostream* out, false_type) {
+        for (int c = 0; c < var_->columns(); c++) {
+            if (c > 0 && hasSpaces_) {
+                *out << ' ';
+            }
+            *out << row[c];
+        }
+    }
+
+    void parseRow(istream* in, typename Grid<T>::iterator row, int rowIndex, int columns, true_type) {
+        if (columns == 0 || !CharRowParser::tryParse(in, &*row, columns)) {
+            parseRow(in, row, rowIndex, columns, false_type());
+        }
+    }
+
+    void parseRow(istream* in, typename Grid<T>::iterator row, int rowIndex, int columns, false_type) {
+        for (int c = 0; c < columns; c++) {
+            if (c > 0 && hasSpaces_) {
+                WhitespaceManipulator::parseSpace(in, TokenContext::matrixElement(name(), rowIndex, c - 1));
+            }
+            T value;
+            Variable::parseValue(in, value, TokenContext::matrixElement(name(), rowIndex, c));
+            row[c] = value;
+        }
+    }
+};
+
+class BitGridImpl : public Matrix {
+private:
+    BitGrid* var_;
+    string row_;
+
+public:
+    virtual ~BitGridImpl() = default;
+
+    BitGridImpl(BitGrid& var, string name)
+            : Matrix(name)
+            , var_(&var) {}
+
+    int rows() const {
+        return var_->rows();
+    }
+
+    int columns(int) const {
+        return var_->columns();
+    }
+
+    void clear() {
+        var_->clear();
+    }
+
+    bool canPrintConcurrently() const {
+        return false;
+    }
+
+    void printTo(ostream* out) {
+        for (int row = 0; row < var_->rows(); row++) {
+            BitGridImpl::printRowTo(row, out);
+            *out << endl;
+        }
+    }
+
+    void printRowTo(int rowIndex, ostream* out) {
+        row_.resize(var_->columns());
+        for (int c = 0; c < var_->columns(); c++) {
+            row_[c] = var_->get(rowIndex, c) ? var_->onChar() : var_->offChar();
+        }
+        out->write(row_.data(), row_.size());
+    }
+
+    void resize(int rows, int columns) {
+        var_->assign(rows, columns);
+    }
+
+    void parseFrom(istream* in, int rows, int columns) {
+        BitGridImpl::resize(rows, columns);
+        BitGridImpl::parseRowsFrom(in, 0, rows, columns);
+    }
+
+    // Each row has its own words, so disjoint ranges of rows can be parsed concurrently.
+    void parseRowsFrom(istream* in, int begin, int end, int columns) {
+        string row(columns, ' ');
+        for (int r = begin; r < end; r++) {
+            if (columns > 0 && CharRowParser::tryParse(in, &row[0], columns)) {
+                for (int c = 0; c < columns; c++) {
+                    var_->set(r, c, toBit(row[c], r, c));
+                }
+            } else {
+                for (int c = 0; c < columns; c++) {
+                    char element;
+                    Variable::parseValue(in, element, TokenContext::matrixElement(name(), r, c));
+                    var_->set(r, c, toBit(element, r, c));
+                }
+            }
+            WhitespaceManipulator::parseNewline(in, TokenContext::matrixElement(name(), r, columns - 1));
+        }
+    }
+
+    void parseAndAddRowFrom(istream* in, int rowIndex) {
+        vector<bool> row;
+        for (int c = 0; !WhitespaceManipulator::canParseNewline(in); c++) {
+            char element;
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+            row.push_back(toBit(element, rowIndex, c));
+        }
+        var_->addRow(row);
+    }
+
+private:
+    bool toBit(char element, int rowIndex, int columnIndex) {
+        if (element == var_->onChar()) {
+            return true;
+        }
+        if (element == var_->offChar()) {
+            return false;
+        }
+        throw runtime_error(
+                "Cannot parse for " + TokenFormatter::formatMatrixElement(name(), rowIndex, columnIndex)
+                + ". Found: '" + string(1, element) + "'");
+    }
 };
 
 template<typename T, typename>
@@ -116,4 +362,14 @@ Matrix* Matrix::create(vector<vector<T>>& var, string name) {
     return new MatrixImpl<T>(var, name);
 }
 
+template<typename T, typename>
+Matrix* Matrix::create(Grid<T>& var, string name) {
+    return new GridImpl<T>(var, name);
+}
+
+template<typename>
+Matrix* Matrix::create(BitGrid& var, string name) {
+    return new BitGridImpl(var, name);
+}
+
 }
@@ -4,7 +4,7 @@
 #include <iostream>
 #include <string>
 
-#include "TokenFormatter.hpp"
+#include "TokenContext.hpp"
 #include "Variable.hpp"
 #include "WhitespaceManipulator.hpp"
 
@@ -48,7 +48,7 @@ public:
     }
 
     void parseFrom(istream* in) {
-        Variable::parseValue(in, *var_, TokenFormatter::formatVariable(name()));
+        Variable::parseValue(in, *var_, TokenContext::variable(name()));
     }
 };
 
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+
+using std::function;
+using std::move;
+
+namespace tcframe {
+
+/*
+ * Vector whose elements are not stored. It can be used in place of vector<T> in line and lines
+ * segments. When parsed, each element is checked against the optional predicate and then discarded;
+ * only the number of elements and the last element are kept, so that huge outputs can be validated
+ * in constant memory.
+ *
+ * To be printed, it must be given a producer with produce(size, producer), which is called once per
+ * element, in order of index, while printing. Produced elements are checked against the predicate as
+ * well, so that huge inputs can be generated and constrained in constant memory. As this happens after
+ * the constraints have been verified, constraints may use size() but not back(), and a produced element
+ * that does not satisfy the predicate is reported as an unsatisfied constraint.
+ */
+template<typename T>
+class StreamedVector {
+private:
+    function<bool(const T&)> predicate_;
+    function<T(int)> producer_;
+    int size_;
+    T last_;
+
+public:
+    StreamedVector()
+            : size_(0)
+            , last_() {}
+
+    explicit StreamedVector(function<bool(const T&)> predicate)
+            : predicate_(move(predicate))
+            , size_(0)
+            , last_() {}
+
+    int size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    const T& back() const {
+        return last_;
+    }
+
+    void clear() {
+        producer_ = nullptr;
+        size_ = 0;
+        last_ = T();
+    }
+
+    void produce(int size, function<T(int)> producer) {
+        producer_ = move(producer);
+        size_ = size;
+        last_ = T();
+    }
+
+    bool hasProducer() const {
+        return (bool) producer_;
+    }
+
+    T produceAt(int index) {
+        last_ = producer_(index);
+        return last_;
+    }
+
+    bool accepts(const T& element) const {
+        return !predicate_ || predicate_(element);
+    }
+
+    void push_back(const T& element) {
+        last_ = element;
+        size_++;
+    }
+};
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "TokenFormatter.hpp"
+
+using std::move;
+using std::string;
+
+namespace tcframe {
+
+// Identifies the token being parsed, for use in error messages. Creating one is cheap: it only
+// refers to the variable name and indices, and the message is formatted only when an error occurs.
+// The referenced name must outlive the context.
+struct TokenContext {
+private:
+    enum class Type {
+        TEXT,
+        VARIABLE,
+        VECTOR_ELEMENT,
+        MATRIX_ELEMENT
+    };
+
+    Type type_;
+    string text_;
+    const string* name_;
+    int rowIndex_;
+    int colIndex_;
+
+    TokenContext(Type type, const string* name, int rowIndex, int colIndex)
+            : type_(type)
+            , name_(name)
+            , rowIndex_(rowIndex)
+            , colIndex_(colIndex) {}
+
+public:
+    TokenContext()
+            : TokenContext(string()) {}
+
+    TokenContext(string text)
+            : type_(Type::TEXT)
+            , text_(move(text))
+            , name_(nullptr)
+            , rowIndex_(0)
+            , colIndex_(0) {}
+
+    TokenContext(const char* text)
+            : TokenContext(string(text)) {}
+
+    static TokenContext variable(const string& name) {
+        return {Type::VARIABLE, &name, 0, 0};
+    }
+
+    static TokenContext vectorElement(const string& name, int index) {
+        return {Type::VECTOR_ELEMENT, &name, index, 0};
+    }
+
+    static TokenContext matrixElement(const string& name, int rowIndex, int colIndex) {
+        return {Type::MATRIX_ELEMENT, &name, rowIndex, colIndex};
+    }
+
+    bool empty() const {
+        return type_ == Type::TEXT && text_.empty();
+    }
+
+    string toString() const {
+        switch (type_) {
+            case Type::VARIABLE:
+                return TokenFormatter::formatVariable(*name_);
+            case Type::VECTOR_ELEMENT:
+                return TokenFormatter::formatVectorElement(*name_, rowIndex_);
+            case Type::MATRIX_ELEMENT:
+                return TokenFormatter::formatMatrixElement(*name_, rowIndex_, colIndex_);
+            default:
+                return text_;
+        }
+    }
+};
+
+}
@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "IntegerParser.hpp"
+#include "TokenContext.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::char_traits;
@@ -55,9 +57,23 @@ public:
         return tie(name_, type_) == tie(o->name_, o->type_);
     }
 
+    // Whether different elements/rows can be printed from several threads at the same time.
+    virtual bool canPrintConcurrently() const {
+        return true;
+    }
+
+    // Whether different elements/rows can be parsed in place from several threads at the same time.
+    virtual bool canParseConcurrently() const {
+        return true;
+    }
+
     /* Visible for testing */
     template<typename T>
-    static void parseValue(istream* in, T& var, const string& context) {
+    static void parseValue(istream* in, T& var, const TokenContext& context) {
+        if (IntegerParser::tryParse(in, var)) {
+            return;
+        }
+
         WhitespaceManipulator::ensureNoEof(in, context);
         WhitespaceManipulator::ensureNoWhitespace(in, context);
 
@@ -71,7 +87,7 @@ public:
             string found;
             *in >> found;
 
-            throw runtime_error("Cannot parse for " + context + ". Found: '" + found + "'");
+            throw runtime_error("Cannot parse for " + context.toString() + ". Found: '" + found + "'");
         }
     }
 
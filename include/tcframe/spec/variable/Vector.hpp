@@ -2,14 +2,20 @@
 
 #include <exception>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 
+#include "StreamedVector.hpp"
+#include "TokenContext.hpp"
 #include "TokenFormatter.hpp"
 #include "Variable.hpp"
 #include "WhitespaceManipulator.hpp"
+#include "tcframe/exception.hpp"
 
 using std::iostream;
+using std::is_same;
 using std::ostream;
+using std::runtime_error;
 using std::vector;
 
 namespace tcframe {
@@ -23,15 +29,21 @@ public:
 
     virtual int size() const = 0;
     virtual void clear() = 0;
+    virtual void reserve(int size) = 0;
+    virtual void resize(int size) = 0;
     virtual void printTo(ostream* out) = 0;
     virtual void printElementTo(int index, ostream* out) = 0;
     virtual void parseFrom(istream* in) = 0;
     virtual void parseFrom(istream* in, int size) = 0;
     virtual void parseAndAddElementFrom(istream* in) = 0;
+    virtual void parseElementAt(istream* in, int index) = 0;
 
     template<typename T, typename = ScalarCompatible<T>>
     static Vector* create(vector<T>& var, string name);
 
+    template<typename T, typename = ScalarCompatible<T>>
+    static Vector* create(StreamedVector<T>& var, string name);
+
     template<typename = void>
     static Vector* createRaw(vector<string>& var, string name);
 };
@@ -56,9 +68,22 @@ public:
         var_->clear();
     }
 
+    void reserve(int size) {
+        var_->reserve(size);
+    }
+
+    void resize(int size) {
+        var_->resize(size);
+    }
+
+    // Elements of vector<bool> share words, so writing different elements from several threads races.
+    bool canParseConcurrently() const {
+        return !is_same<T, bool>::value;
+    }
+
     void printTo(ostream* out) {
         bool first = true;
-        for (T& element : *var_) {
+        for (const T& element : *var_) {
             if (!first) {
                 *out << ' ';
             }
@@ -76,27 +101,34 @@ public:
             if (i > 0) {
                 WhitespaceManipulator::parseSpaceAfterMissingNewline(
                         in,
-                        TokenFormatter::formatVectorElement(name(), i - 1));
+                        TokenContext::vectorElement(name(), i - 1));
             }
             parseAndAddElementFrom(in);
         }
     }
 
     void parseFrom(istream* in, int size) {
+        var_->reserve(var_->size() + size);
         for (int i = 0; i < size; i++) {
             if (i > 0) {
-                WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(name(), i - 1));
+                WhitespaceManipulator::parseSpace(in, TokenContext::vectorElement(name(), i - 1));
             }
             parseAndAddElementFrom(in);
         }
     }
 
     void parseAndAddElementFrom(istream* in) {
-        int index = size();
+        int index = (int) var_->size();
         T element;
-        Variable::parseValue(in, element, TokenFormatter::formatVectorElement(name(), index));
+        Variable::parseValue(in, element, TokenContext::vectorElement(name(), index));
         var_->push_back(element);
     }
+
+    void parseElementAt(istream* in, int index) {
+        T element;
+        Variable::parseValue(in, element, TokenContext::vectorElement(name(), index));
+        (*var_)[index] = element;
+    }
 };
 
 class RawVectorImpl : public VectorImpl<string> {
@@ -118,11 +150,120 @@ public:
     }
 };
 
+template<typename T, typename = ScalarCompatible<T>>
+class StreamedVectorImpl : public Vector {
+private:
+    StreamedVector<T>* var_;
+
+public:
+    virtual ~StreamedVectorImpl() = default;
+
+    StreamedVectorImpl(StreamedVector<T>& var, string name)
+            : Vector(name)
+            , var_(&var) {}
+
+    int size() const {
+        return var_->size();
+    }
+
+    void clear() {
+        var_->clear();
+    }
+
+    // Elements are not stored, so they can only be parsed in order.
+    void reserve(int) {}
+
+    void resize(int) {}
+
+    bool canPrintConcurrently() const {
+        return false;
+    }
+
+    bool canParseConcurrently() const {
+        return false;
+    }
+
+    void printTo(ostream* out) {
+        for (int i = 0; i < size(); i++) {
+            if (i > 0) {
+                *out << ' ';
+            }
+            StreamedVectorImpl::printElementTo(i, out);
+        }
+    }
+
+    void printElementTo(int index, ostream* out) {
+        if (!var_->hasProducer()) {
+            throw runtime_error(
+                    "Streamed vector " + TokenFormatter::formatVariable(name())
+                    + " cannot be printed without a producer");
+        }
+        T element = var_->produceAt(index);
+
+        // Produced elements are only known while printing, after the constraints have been verified, so
+        // a violation is reported as one of them.
+        if (!var_->accepts(element)) {
+            throw FormattedError({
+                    {0, "Does not satisfy constraints, on:"},
+                    {1, describeViolation(index)}});
+        }
+        *out << element;
+    }
+
+    void parseFrom(istream* in) {
+        for (int i = 0; !WhitespaceManipulator::canParseNewline(in); i++) {
+            if (i > 0) {
+                WhitespaceManipulator::parseSpaceAfterMissingNewline(
+                        in,
+                        TokenContext::vectorElement(name(), i - 1));
+            }
+            StreamedVectorImpl::parseAndAddElementFrom(in);
+        }
+    }
+
+    void parseFrom(istream* in, int size) {
+        for (int i = 0; i < size; i++) {
+            if (i > 0) {
+                WhitespaceManipulator::parseSpace(in, TokenContext::vectorElement(name(), i - 1));
+            }
+            StreamedVectorImpl::parseAndAddElementFrom(in);
+        }
+    }
+
+    void parseAndAddElementFrom(istream* in) {
+        int index = var_->size();
+        T element;
+        Variable::parseValue(in, element, TokenContext::vectorElement(name(), index));
+        checkElement(index, element);
+        var_->push_back(element);
+    }
+
+    void parseElementAt(istream* in, int) {
+        StreamedVectorImpl::parseAndAddElementFrom(in);
+    }
+
+private:
+    void checkElement(int index, const T& element) {
+        if (!var_->accepts(element)) {
+            throw runtime_error(describeViolation(index));
+        }
+    }
+
+    string describeViolation(int index) const {
+        return "Element " + TokenFormatter::formatVectorElement(name(), index) + " does not satisfy its predicate";
+    }
+};
+
 template<typename T, typename>
 Vector* Vector::create(vector<T>& var, string name) {
     return new VectorImpl<T>(var, name);
 }
 
+template<typename T, typename>
+Vector* Vector::create(StreamedVector<T>& var, string name) {
+    return new StreamedVectorImpl<T>(var, name);
+}
+
 template<typename>
 Vector* Vector::createRaw(vector<string>& var, string name) {
     return new RawVectorImpl(var, name);
@@ -6,6 +6,8 @@
 #include <string>
 #include <type_traits>
 
+#include "TokenContext.hpp"
+
 using std::char_traits;
 using std::istream;
 using std::ostream;
@@ -18,15 +20,15 @@ class WhitespaceManipulator {
 public:
     WhitespaceManipulator() = delete;
 
-    static void parseSpace(istream* in, const string& context) {
+    static void parseSpace(istream* in, const TokenContext& context) {
         if (in->get() != ' ') {
-            throw runtime_error("Expected: <space> after " + context);
+            throw runtime_error("Expected: <space> after " + context.toString());
         }
     }
 
-    static void parseSpaceAfterMissingNewline(istream* in, const string& context) {
+    static void parseSpaceAfterMissingNewline(istream* in, const TokenContext& context) {
         if (in->get() != ' ') {
-            throw runtime_error("Expected: <space> or <newline> after " + context);
+            throw runtime_error("Expected: <space> or <newline> after " + context.toString());
         }
     }
 
@@ -34,9 +36,9 @@ public:
         return in->peek() == '\n';
     }
 
-    static void parseNewline(istream* in, const string& context) {
+    static void parseNewline(istream* in, const TokenContext& context) {
         if (in->get() != '\n') {
-            throw runtime_error("Expected: <newline> after " + context);
+            throw runtime_error("Expected: <newline> after " + context.toString());
         }
     }
 
@@ -50,21 +52,21 @@ public:
         }
     }
 
-    static void ensureEof(istream* in, const string& context) {
+    static void ensureEof(istream* in, const TokenContext& context) {
         if (in->peek() != char_traits<char>::eof()) {
-            throw runtime_error("Expected: <EOF> after " + context);
+            throw runtime_error("Expected: <EOF> after " + context.toString());
         }
     }
 
-    static void ensureNoEof(istream* in, const string& context) {
+    static void ensureNoEof(istream* in, const TokenContext& context) {
         if (in->peek() == char_traits<char>::eof()) {
-            throw runtime_error("Cannot parse for " + context + ". Found: <EOF>");
+            throw runtime_error("Cannot parse for " + context.toString() + ". Found: <EOF>");
         }
     }
 
-    static void ensureNoWhitespace(istream* in, const string& context) {
+    static void ensureNoWhitespace(istream* in, const TokenContext& context) {
         if (isspace(in->peek())) {
-            throw runtime_error("Cannot parse for " + context + ". Found: <whitespace>");
+            throw runtime_error("Cannot parse for " + context.toString() + ". Found: <whitespace>");
         }
     }
 };
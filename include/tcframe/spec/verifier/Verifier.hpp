@@ -19,26 +19,75 @@ namespace tcframe {
 class Verifier {
 private:
     ConstraintSuite constraintSuite_;
+    bool checkSubtaskAssignment_ = true;
+
+    // Constraints with the same description are assumed to be the same expression (which fails if it
+    // refers to a local that differs between subtasks; see CONS() in the docs), so each distinct
+    // description is evaluated at most once per verification. These are the description indices, per
+    // subtask.
+    vector<vector<int>> constraintIndicesBySubtask_;
+    int distinctConstraintCount_ = 0;
 
 public:
     virtual ~Verifier() = default;
 
     explicit Verifier(ConstraintSuite constraintSuite)
-            : constraintSuite_(move(constraintSuite)) {}
+            : constraintSuite_(move(constraintSuite)) {
+
+        map<string, int> indicesByDescription;
+        for (const Subtask& subtask : constraintSuite_.constraints()) {
+            vector<int> constraintIndices;
+            for (const Constraint& constraint : subtask.constraints()) {
+                auto it = indicesByDescription.find(constraint.description());
+                if (it == indicesByDescription.end()) {
+                    it = indicesByDescription.emplace(constraint.description(), distinctConstraintCount_++).first;
+                }
+                constraintIndices.push_back(it->second);
+            }
+            constraintIndicesBySubtask_.push_back(constraintIndices);
+        }
+    }
+
+    // If false, constraints of subtasks that a test case is not assigned to are not evaluated, so that
+    // "satisfies subtask but is not assigned to it" is never reported.
+    virtual void setCheckSubtaskAssignment(bool checkSubtaskAssignment) {
+        checkSubtaskAssignment_ = checkSubtaskAssignment;
+    }
 
     virtual ConstraintsVerificationResult verifyConstraints(const set<int>& subtaskIds) {
         map<int, vector<string>> unsatisfiedConstraintDescriptionsBySubtaskId;
         set<int> satisfiedButNotAssignedSubtaskIds;
 
-        for (const Subtask& subtask : constraintSuite_.constraints()) {
+        vector<char> isEvaluated(distinctConstraintCount_, false);
+        vector<ConstraintResult> results(distinctConstraintCount_);
+
+        const vector<Subtask>& subtasks = constraintSuite_.constraints();
+        for (int i = 0; i < subtasks.size(); i++) {
+            const Subtask& subtask = subtasks[i];
+            bool isAssigned = subtask.id() == Subtask::MAIN_ID || subtaskIds.count(subtask.id());
+            if (!isAssigned && !checkSubtaskAssignment_) {
+                continue;
+            }
+
             vector<string> unsatisfiedConstraintDescriptions;
-            for (const Constraint& constraint : subtask.constraints()) {
-                if (!constraint.predicate()()) {
-                    unsatisfiedConstraintDescriptions.push_back(constraint.description());
+            for (int j = 0; j < subtask.constraints().size(); j++) {
+                const Constraint& constraint = subtask.constraints()[j];
+                int index = constraintIndicesBySubtask_[i][j];
+                if (!isEvaluated[index]) {
+                    isEvaluated[index] = true;
+                    results[index] = constraint.predicate()();
+                }
+                if (!results[index]) {
+                    unsatisfiedConstraintDescriptions.push_back(results[index].describe(constraint.description()));
+
+                    // Only whether all constraints are satisfied matters for a non-assigned subtask.
+                    if (!isAssigned) {
+                        break;
+                    }
                 }
             }
 
-            if (subtask.id() == Subtask::MAIN_ID || subtaskIds.count(subtask.id())) {
+            if (isAssigned) {
                 if (!unsatisfiedConstraintDescriptions.empty()) {
                     unsatisfiedConstraintDescriptionsBySubtaskId[subtask.id()] = unsatisfiedConstraintDescriptions;
                 }
@@ -54,8 +103,9 @@ public:
     virtual MultipleTestCasesConstraintsVerificationResult verifyMultipleTestCasesConstraints() {
         set<string> unsatisfiedConstraintDescriptions;
         for (const Constraint& constraint : constraintSuite_.multipleTestCasesConstraints()) {
-            if (!constraint.predicate()()) {
-                unsatisfiedConstraintDescriptions.insert(constraint.description());
+            ConstraintResult result = constraint.predicate()();
+            if (!result) {
+                unsatisfiedConstraintDescriptions.insert(result.describe(constraint.description()));
             }
         }
         return MultipleTestCasesConstraintsVerificationResult(unsatisfiedConstraintDescriptions);
@@ -1,4 +1,5 @@
 #pragma once
 
+#include "tcframe/util/MemoryBuffer.hpp"
 #include "tcframe/util/StringUtils.hpp"
 #include "tcframe/util/optional.hpp"
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <ios>
+#include <streambuf>
+
+using std::ios;
+using std::streambuf;
+
+namespace tcframe {
+
+// Read-only stream buffer over a range of memory. The whole range is exposed as the get area, so
+// reading never copies into an intermediate buffer, and seeking is just a pointer reset.
+class MemoryBuffer : public streambuf {
+public:
+    virtual ~MemoryBuffer() = default;
+
+    MemoryBuffer() = default;
+
+    MemoryBuffer(const char* begin, const char* end) {
+        setRange(begin, end);
+    }
+
+protected:
+    void setRange(const char* begin, const char* end) {
+        setg((char*) begin, (char*) begin, (char*) end);
+    }
+
+    pos_type seekoff(off_type off, ios::seekdir dir, ios::openmode which) {
+        if (!(which & ios::in)) {
+            return pos_type(off_type(-1));
+        }
+
+        off_type base;
+        if (dir == ios::beg) {
+            base = 0;
+        } else if (dir == ios::cur) {
+            base = gptr() - eback();
+        } else {
+            base = egptr() - eback();
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, ios::openmode which) {
+        off_type off = off_type(pos);
+        if (!(which & ios::in) || off < 0 || off > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + off, egptr());
+        return pos;
+    }
+};
+
+}
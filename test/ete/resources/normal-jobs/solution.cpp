@@ -0,0 +1,13 @@
+#include <cstdio>
+
+int main() {
+    int N;
+    scanf("%d", &N);
+    for (int i = 0; i < N; i++) {
+        int a;
+        scanf("%d", &a);
+        if (a > 0) {
+            printf("%s\n", a % 2 == 0 ? "even" : "odd");
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include <bits/stdc++.h>
+#include <tcframe/spec.hpp>
+
+using namespace std;
+using namespace tcframe;
+
+class ProblemSpec : public BaseProblemSpec {
+protected:
+    int N;
+    vector<int> A;
+
+    int positive_count;
+    vector<string> answers;
+
+    void InputFormat() {
+        LINE(N);
+        LINE(A % SIZE(N));
+    }
+
+    void BeforeOutputFormat() {
+        positive_count = count_if(A.begin(), A.end(), [](int a) {return a > 0;});
+    }
+
+    void OutputFormat() {
+        LINES(answers) % SIZE(positive_count);
+    }
+
+    void GradingConfig() {
+        TimeLimit(2);
+        MemoryLimit(64);
+    }
+
+    void Constraints() {
+        CONS(1 <= N && N <= 1000);
+    }
+};
+
+class TestSpec : public BaseTestSpec<ProblemSpec> {
+protected:
+    void BeforeTestCase() {
+        A.clear();
+    }
+
+    void SampleTestCase1() {
+        Input({
+            "3",
+            "1 -2 4"
+        });
+        Output({
+            "odd",
+            "even"
+        });
+    }
+
+    void TestCases() {
+        for (int n : {1, 10, 100, 1000, 1000, 1000}) {
+            CASE(N = n, randomElements());
+        }
+    }
+
+private:
+    void randomElements() {
+        for (int i = 0; i < N; i++) {
+            A.push_back(rnd.nextInt(-1000, 1000));
+        }
+    }
+};
@@ -7,4 +7,4 @@ export TCFRAME_CXX_FLAGS="-I .."
 
 g++ -o solution solution.cpp
 $TCFRAME_HOME/scripts/tcframe build
-./runner --solution=./solution
+./runner --solution=./solution "$@"
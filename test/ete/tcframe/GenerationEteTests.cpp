@@ -95,6 +95,15 @@ TEST_F(GenerationEteTests, Normal_Lifecycle) {
             "even\n"));
 }
 
+TEST_F(GenerationEteTests, Normal_Jobs) {
+    ASSERT_THAT(execStatus(
+            "cd test-ete/normal-jobs && ../scripts/generate.sh "
+            "&& rm -rf tc-1 && mv tc tc-1 && ../scripts/generate.sh --jobs=3"), Eq(0));
+
+    EXPECT_THAT(ls("test-ete/normal-jobs/tc").size(), Eq(14));
+    EXPECT_THAT(execStatus("diff -r test-ete/normal-jobs/tc-1 test-ete/normal-jobs/tc"), Eq(0));
+}
+
 TEST_F(GenerationEteTests, Subtasks) {
     ASSERT_THAT(execStatus("cd test-ete/subtasks && ../scripts/generate.sh"), Eq(0));
 
@@ -138,6 +147,14 @@ TEST_F(GenerationEteTests, Multi) {
             "6\n"));
 }
 
+TEST_F(GenerationEteTests, Multi_Jobs) {
+    ASSERT_THAT(execStatus(
+            "cd test-ete/multi && ../scripts/generate.sh "
+            "&& rm -rf tc-1 && mv tc tc-1 && ../scripts/generate.sh --jobs=3"), Eq(0));
+
+    EXPECT_THAT(execStatus("diff -r test-ete/multi/tc-1 test-ete/multi/tc"), Eq(0));
+}
+
 TEST_F(GenerationEteTests, Multi_NoOutput) {
     ASSERT_THAT(execStatus("cd test-ete/multi-no-output && ../scripts/generate-without-solution.sh"), Eq(0));
 
@@ -0,0 +1,88 @@
+#include "gmock/gmock.h"
+
+#include <chrono>
+#include <sstream>
+
+#include "tcframe/driver/SpecDriver.hpp"
+#include "tcframe/runner/client/SpecClient.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ostringstream;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+namespace tcframe {
+
+// Benchmarks the test suite model on 100000 test cases: building the suite, and then going through it
+// the way the generator does, without the actual input generation and file I/O. The timings are recorded
+// as test properties, e.g. in the XML report of --gtest_output=xml.
+class LargeTestSuiteIntegrationTests : public Test {
+protected:
+    static const int TEST_GROUP_COUNT = 10;
+    static const int TEST_CASE_COUNT_PER_GROUP = 10000;
+
+    class CountingTestCaseDriver : public TestCaseDriver {
+    public:
+        int count = 0;
+
+        CountingTestCaseDriver()
+                : TestCaseDriver(nullptr, nullptr, nullptr, MultipleTestCasesConfig()) {}
+
+        void generateInput(const TestCase&, ostream*) {
+            count++;
+        }
+    };
+
+    class InMemoryOperatingSystem : public OperatingSystem {
+    public:
+        ostream* openForBackgroundWriting(const string&) {
+            return new ostringstream();
+        }
+    };
+
+    static double secondsSince(steady_clock::time_point start) {
+        return duration<double>(steady_clock::now() - start).count();
+    }
+};
+
+TEST_F(LargeTestSuiteIntegrationTests, Generation) {
+    steady_clock::time_point start = steady_clock::now();
+
+    TestSuiteBuilder builder = TestSuiteBuilder().setSlug("foo").setDefinedSubtaskIds({1, 2, 3});
+    for (int i = 0; i < TEST_GROUP_COUNT; i++) {
+        builder.newTestGroup().Subtasks({1 + i % 3, 3});
+        for (int j = 0; j < TEST_CASE_COUNT_PER_GROUP; j++) {
+            builder.addOfficialTestCase([]{}, "N = " + StringUtils::toString(j));
+        }
+    }
+    TestSuite testSuite = builder.build();
+    double buildSeconds = secondsSince(start);
+
+    start = steady_clock::now();
+    CountingTestCaseDriver testCaseDriver;
+    InMemoryOperatingSystem os;
+    SpecDriver specDriver(&testCaseDriver, nullptr, MultipleTestCasesConfig(), move(testSuite));
+    SpecClient specClient(&specDriver, &os);
+
+    for (int pass = 0; pass < 2; pass++) {
+        const TestSuite& suite = specClient.getTestSuite();
+        for (const TestGroup& testGroup : suite.testGroups()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                specClient.generateTestCaseInput(testCase.name(), "");
+            }
+        }
+    }
+    double generationSeconds = secondsSince(start);
+
+    RecordProperty("build_seconds", StringUtils::toString(buildSeconds));
+    RecordProperty("lookup_seconds", StringUtils::toString(generationSeconds));
+
+    const TestSuite& suite = specClient.getTestSuite();
+    EXPECT_THAT(testCaseDriver.count, Eq(2 * TEST_GROUP_COUNT * TEST_CASE_COUNT_PER_GROUP));
+    EXPECT_THAT(suite.testGroups()[1].testCases()[0].sharedSubtaskIds(),
+                Eq(suite.testGroups()[4].testCases()[9999].sharedSubtaskIds()));
+}
+
+}
@@ -1,13 +1,23 @@
 #include "gmock/gmock.h"
 
 #include <cstdlib>
+#include <future>
+#include <vector>
 
+#include "tcframe/runner/os/ContentHasher.hpp"
 #include "tcframe/runner/os/OperatingSystem.hpp"
 #include "tcframe/util.hpp"
 
 using ::testing::Eq;
 using ::testing::Test;
 
+using std::async;
+using std::char_traits;
+using std::endl;
+using std::future;
+using std::launch;
+using std::vector;
+
 namespace tcframe {
 
 class OperatingSystemIntegrationTests : public Test {
@@ -22,6 +32,63 @@ protected:
     }
 };
 
+TEST_F(OperatingSystemIntegrationTests, BackgroundWriting) {
+    vector<optional<uint64_t>> contentHashes;
+    for (int i = 1; i <= 3; i++) {
+        string filename = "test-integration/os/background_" + StringUtils::toString(i) + ".out";
+        ostream* out = os.openForBackgroundWriting(filename);
+        *out << string(3000000, (char) ('0' + i)) << endl;
+        os.closeOpenedStream(out);
+        contentHashes.push_back(os.waitForBackgroundWriting(filename));
+    }
+    for (int i = 1; i <= 3; i++) {
+        istream* in = os.openForReading("test-integration/os/background_" + StringUtils::toString(i) + ".out");
+        EXPECT_THAT(StringUtils::streamToString(in), Eq(string(3000000, (char) ('0' + i)) + "\n"));
+        os.closeOpenedStream(in);
+
+        in = os.openForReading("test-integration/os/background_" + StringUtils::toString(i) + ".out");
+        EXPECT_THAT(contentHashes[i - 1], Eq(optional<uint64_t>(ContentHasher::hash(in))));
+        os.closeOpenedStream(in);
+    }
+    EXPECT_FALSE(os.waitForBackgroundWriting("test-integration/os/background_1.out"));
+}
+
+TEST_F(OperatingSystemIntegrationTests, BackgroundWriting_Failed) {
+    ostream* failedOut = os.openForBackgroundWriting("test-integration/os/nonexistent/1.out");
+    *failedOut << 42 << endl;
+    os.closeOpenedStream(failedOut);
+
+    ostream* out = os.openForBackgroundWriting("test-integration/os/background_1.out");
+    *out << 42 << endl;
+    os.closeOpenedStream(out);
+
+    // The error is only reported to the producer of the failed file.
+    os.closeOpenedStream(os.openForReading("test-integration/os/1.in"));
+    os.waitForBackgroundWriting("test-integration/os/background_1.out");
+    try {
+        os.waitForBackgroundWriting("test-integration/os/nonexistent/1.out");
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(string(e.what()), Eq("Cannot write test-integration/os/nonexistent/1.out"));
+    }
+    os.waitForBackgroundWriting("test-integration/os/nonexistent/1.out");
+}
+
+TEST_F(OperatingSystemIntegrationTests, BackgroundWriting_Execution) {
+    ostream* out = os.openForBackgroundWriting("test-integration/os/background_1.out");
+    *out << string(3000000, '1') << endl;
+    os.closeOpenedStream(out);
+
+    // The execution waits for its input to be written.
+    os.execute(ExecutionRequestBuilder()
+            .setCommand("wc -c")
+            .setInputFilename("test-integration/os/background_1.out")
+            .setOutputFilename("test-integration/os/background_2.out")
+            .build());
+    EXPECT_THAT(readFile("test-integration/os/background_2.out"), Eq("3000001\n"));
+    os.waitForBackgroundWriting("test-integration/os/background_1.out");
+}
+
 TEST_F(OperatingSystemIntegrationTests, Execution_Successful) {
     system(
             "g++ -o "
@@ -42,6 +109,20 @@ TEST_F(OperatingSystemIntegrationTests, Execution_Successful) {
     EXPECT_THAT(result.standardError(), Eq("44\n"));
 }
 
+TEST_F(OperatingSystemIntegrationTests, Execution_Concurrent) {
+    vector<future<ExecutionResult>> results;
+    for (int i = 0; i < 8; i++) {
+        results.push_back(async(launch::async, [this, i] {
+            return os.execute(ExecutionRequestBuilder()
+                    .setCommand("sleep 0.1; echo " + StringUtils::toString(i) + " >&2")
+                    .build());
+        }));
+    }
+    for (int i = 0; i < 8; i++) {
+        EXPECT_THAT(results[i].get().standardError(), Eq(StringUtils::toString(i) + "\n"));
+    }
+}
+
 TEST_F(OperatingSystemIntegrationTests, Execution_ExceededTimeLimits) {
     system(
             "g++ -o "
@@ -108,4 +189,24 @@ TEST_F(OperatingSystemIntegrationTests, Execution_Crashed_ExitSignal) {
     EXPECT_THAT(result.exitSignal(), Eq(optional<int>(SIGFPE)));
 }
 
+TEST_F(OperatingSystemIntegrationTests, MappedReading) {
+    istream* in = os.openForMappedReading("test-integration/os/1.in");
+
+    long long initialPos = in->tellg();
+    int value;
+    *in >> value;
+    EXPECT_THAT(value, Eq(42));
+
+    in->seekg(initialPos);
+    EXPECT_THAT(StringUtils::streamToString(in), Eq("42\n"));
+
+    os.closeOpenedStream(in);
+}
+
+TEST_F(OperatingSystemIntegrationTests, MappedReading_NonexistentFile) {
+    istream* in = os.openForMappedReading("test-integration/os/nonexistent.in");
+    EXPECT_THAT(in->peek(), Eq(char_traits<char>::eof()));
+    os.closeOpenedStream(in);
+}
+
 }
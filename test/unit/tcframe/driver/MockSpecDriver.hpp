@@ -11,13 +11,17 @@ public:
     MockSpecDriver()
             : SpecDriver(nullptr, nullptr, MultipleTestCasesConfig(), TestSuite()) {}
 
-    MOCK_METHOD0(getTestSuite, TestSuite());
+    MOCK_METHOD0(getTestSuite, const TestSuite&());
     MOCK_METHOD1(setSeed, void(unsigned));
+    MOCK_METHOD1(setThreads, void(int));
+    MOCK_METHOD1(setCheckSubtaskAssignment, void(bool));
     MOCK_METHOD0(hasMultipleTestCases, bool());
     MOCK_METHOD0(getMultipleTestCasesOutputPrefix, optional<string>());
     MOCK_METHOD2(generateTestCaseInput, void(const string&, ostream*));
     MOCK_METHOD2(generateSampleTestCaseOutput, void(const string&, ostream*));
     MOCK_METHOD1(validateTestCaseOutput, void(istream*));
+    MOCK_METHOD2(validateTestCaseOutput, void(istream*, istream*));
+    MOCK_METHOD0(resetMultipleTestCasesAggregates, void());
     MOCK_METHOD1(validateMultipleTestCasesInput, void(int));
 };
 
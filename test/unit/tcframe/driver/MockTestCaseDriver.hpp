@@ -11,9 +11,13 @@ public:
     MockTestCaseDriver()
             : TestCaseDriver(nullptr, nullptr, nullptr, MultipleTestCasesConfig()) {}
 
+    MOCK_METHOD1(setThreads, void(int));
+    MOCK_METHOD1(setCheckSubtaskAssignment, void(bool));
     MOCK_METHOD2(generateInput, void(const TestCase&, ostream*));
     MOCK_METHOD2(generateSampleOutput, void(const TestCase&, ostream*));
     MOCK_METHOD1(validateOutput, void(istream*));
+    MOCK_METHOD2(validateOutput, void(istream*, istream*));
+    MOCK_METHOD0(resetMultipleTestCasesAggregates, void());
     MOCK_METHOD1(validateMultipleTestCasesInput, void(int));
 };
 
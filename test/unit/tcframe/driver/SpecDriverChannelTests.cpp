@@ -0,0 +1,63 @@
+#include "gmock/gmock.h"
+
+#include <cstdio>
+
+#include "tcframe/driver/SpecDriverChannel.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::fclose;
+using std::rewind;
+using std::tmpfile;
+
+namespace tcframe {
+
+class SpecDriverChannelTests : public Test {
+protected:
+    FILE* file = tmpfile();
+
+    void TearDown() {
+        fclose(file);
+    }
+};
+
+TEST_F(SpecDriverChannelTests, SendAndReceive) {
+    SpecDriverChannel sender(nullptr, file);
+    sender.send({"generateTestCaseInput", "foo_1", "dir/foo_1.in"});
+    sender.send({"error", "line 1\n 2 \n", ""});
+    sender.send({});
+
+    rewind(file);
+    SpecDriverChannel receiver(file, nullptr);
+    vector<string> fields;
+    ASSERT_TRUE(receiver.receive(fields));
+    EXPECT_THAT(fields, Eq(vector<string>{"generateTestCaseInput", "foo_1", "dir/foo_1.in"}));
+    ASSERT_TRUE(receiver.receive(fields));
+    EXPECT_THAT(fields, Eq(vector<string>{"error", "line 1\n 2 \n", ""}));
+    ASSERT_TRUE(receiver.receive(fields));
+    EXPECT_THAT(fields, Eq(vector<string>{}));
+    EXPECT_FALSE(receiver.receive(fields));
+}
+
+TEST_F(SpecDriverChannelTests, Receive_Truncated) {
+    SpecDriverChannel sender(nullptr, file);
+    sender.send({"setSeed", "42"});
+    fflush(file);
+    long size = ftell(file);
+    rewind(file);
+
+    // Keep all but the last byte.
+    string content(size - 1, ' ');
+    ASSERT_THAT(fread(&content[0], 1, content.size(), file), Eq(content.size()));
+    FILE* truncated = tmpfile();
+    fwrite(content.data(), 1, content.size(), truncated);
+    rewind(truncated);
+
+    SpecDriverChannel receiver(truncated, nullptr);
+    vector<string> fields;
+    EXPECT_FALSE(receiver.receive(fields));
+    fclose(truncated);
+}
+
+}
@@ -0,0 +1,112 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include <cstdio>
+
+#include "MockSpecDriver.hpp"
+#include "tcframe/driver/SpecDriverServer.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Test;
+using ::testing::Throw;
+
+using std::fclose;
+using std::rewind;
+using std::tmpfile;
+
+namespace tcframe {
+
+class SpecDriverServerTests : public Test {
+protected:
+    MOCK(SpecDriver) specDriver;
+
+    FILE* requests = tmpfile();
+    FILE* responses = tmpfile();
+
+    void TearDown() {
+        fclose(requests);
+        fclose(responses);
+    }
+
+    // Serves the requests, and returns the responses.
+    vector<vector<string>> serve(const vector<vector<string>>& requestList) {
+        SpecDriverChannel sender(nullptr, requests);
+        for (const vector<string>& request : requestList) {
+            sender.send(request);
+        }
+        rewind(requests);
+
+        SpecDriverChannel channel(requests, responses);
+        SpecDriverServer(&specDriver, &channel).serve();
+        rewind(responses);
+
+        SpecDriverChannel receiver(responses, nullptr);
+        vector<vector<string>> responseList;
+        vector<string> response;
+        while (receiver.receive(response)) {
+            responseList.push_back(response);
+        }
+        return responseList;
+    }
+};
+
+TEST_F(SpecDriverServerTests, Serve) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(specDriver, setSeed(42));
+        EXPECT_CALL(specDriver, setThreads(4));
+        EXPECT_CALL(specDriver, setCheckSubtaskAssignment(false));
+        EXPECT_CALL(specDriver, resetMultipleTestCasesAggregates());
+        EXPECT_CALL(specDriver, generateTestCaseInput("foo_1", _));
+        EXPECT_CALL(specDriver, validateTestCaseOutput(_, _));
+        EXPECT_CALL(specDriver, validateMultipleTestCasesInput(3));
+    }
+    string input = "/dev/null";
+    vector<vector<string>> responses = serve({
+            {"setSeed", "42"},
+            {"setThreads", "4"},
+            {"setCheckSubtaskAssignment", "0"},
+            {"resetMultipleTestCasesAggregates"},
+            {"generateTestCaseInput", "foo_1", input},
+            {"validateTestCaseOutput", input, input},
+            {"validateMultipleTestCasesInput", "3"}});
+    EXPECT_THAT(responses, Eq(vector<vector<string>>(7, {"ok"})));
+}
+
+TEST_F(SpecDriverServerTests, Serve_Errors) {
+    ON_CALL(specDriver, setThreads(_))
+            .WillByDefault(Throw(runtime_error("Unexpected")));
+    ON_CALL(specDriver, validateMultipleTestCasesInput(_))
+            .WillByDefault(Throw(FormattedError({{0, "Constraints not satisfied:"}, {1, "1 <= T"}})));
+
+    vector<vector<string>> responses = serve({
+            {"setThreads", "4"},
+            {"validateMultipleTestCasesInput", "0"},
+            {"setSeed", "x"},
+            {"foo"},
+            {"setSeed", "1"}});
+    EXPECT_THAT(responses, Eq(vector<vector<string>>{
+            {"error", "Unexpected"},
+            {"formatted_error", "0", "Constraints not satisfied:", "1", "1 <= T"},
+            {"error", "Invalid number in spec driver request: x"},
+            {"error", "Unknown spec driver request: foo"},
+            {"ok"}}));
+}
+
+TEST_F(SpecDriverServerTests, Serve_WriteErrors) {
+    ON_CALL(specDriver, generateSampleTestCaseOutput(_, _))
+            .WillByDefault(Invoke([](const string&, ostream* out) { *out << "42\n"; }));
+    EXPECT_CALL(specDriver, generateTestCaseInput(_, _)).Times(0);
+
+    vector<vector<string>> responses = serve({
+            {"generateTestCaseInput", "foo_1", "/nonexistent/foo_1.in"},
+            {"generateSampleTestCaseOutput", "foo_sample_1", "/dev/full"}});
+    EXPECT_THAT(responses, Eq(vector<vector<string>>{
+            {"error", "Cannot write /nonexistent/foo_1.in"},
+            {"error", "Cannot write /dev/full"}}));
+}
+
+}
@@ -48,6 +48,16 @@ TEST_F(SpecDriverTests, SetSeed) {
     driver.setSeed(42);
 }
 
+TEST_F(SpecDriverTests, SetThreads) {
+    EXPECT_CALL(testCaseDriver, setThreads(4));
+    driver.setThreads(4);
+}
+
+TEST_F(SpecDriverTests, SetCheckSubtaskAssignment) {
+    EXPECT_CALL(testCaseDriver, setCheckSubtaskAssignment(false));
+    driver.setCheckSubtaskAssignment(false);
+}
+
 TEST_F(SpecDriverTests, HasMultipleTestCases) {
     EXPECT_TRUE(driver.hasMultipleTestCases());
 }
@@ -62,6 +72,11 @@ TEST_F(SpecDriverTests, GenerateTestCaseInput) {
     driver.generateTestCaseInput("foo_2", &out);
 }
 
+TEST_F(SpecDriverTests, GenerateTestCaseInput_UnknownTestCase) {
+    ostringstream out;
+    EXPECT_THROW(driver.generateTestCaseInput("foo_3", &out), runtime_error);
+}
+
 TEST_F(SpecDriverTests, GenerateSampleTestCaseOutput) {
     ostringstream out;
     EXPECT_CALL(testCaseDriver, generateSampleOutput(stc, &out));
@@ -74,6 +89,18 @@ TEST_F(SpecDriverTests, ValidateTestCaseOutput) {
     driver.validateTestCaseOutput(&in);
 }
 
+TEST_F(SpecDriverTests, ValidateTestCaseOutput_WithInput) {
+    istringstream input;
+    istringstream output;
+    EXPECT_CALL(testCaseDriver, validateOutput(&input, &output));
+    driver.validateTestCaseOutput(&input, &output);
+}
+
+TEST_F(SpecDriverTests, ResetMultipleTestCasesAggregates) {
+    EXPECT_CALL(testCaseDriver, resetMultipleTestCasesAggregates());
+    driver.resetMultipleTestCasesAggregates();
+}
+
 TEST_F(SpecDriverTests, ValidateMultipleTestCasesInput) {
     EXPECT_CALL(testCaseDriver, validateMultipleTestCasesInput(3));
     driver.validateMultipleTestCasesInput(3);
@@ -29,6 +29,7 @@ class TestCaseDriverTests : public Test {
 public:
     static int T;
     static int N;
+    static long long SumN, MaxN, CountLargeN;
 
 protected:
     MOCK(RawIOManipulator) rawIOManipulator;
@@ -49,6 +50,18 @@ protected:
     MultipleTestCasesConfig multipleTestCasesConfig = MultipleTestCasesConfigBuilder()
             .Counter(T)
             .build();
+    TestCase officialTestCase2 = TestCaseBuilder()
+            .setName("foo_2")
+            .setDescription("N = 7")
+            .setSubtaskIds({1, 2})
+            .setData(new OfficialTestCaseData([&]{N = 7;}))
+            .build();
+    MultipleTestCasesConfig multipleTestCasesConfigWithAggregates = MultipleTestCasesConfigBuilder()
+            .Counter(T)
+            .Sum(SumN, [&] {return N;})
+            .Max(MaxN, [&] {return N;})
+            .Count(CountLargeN, [&] {return N > 10;})
+            .build();
     MultipleTestCasesConfig multipleTestCasesConfigWithOutputPrefix = MultipleTestCasesConfigBuilder()
             .Counter(T)
             .OutputPrefix("Case #%d: ")
@@ -59,6 +72,7 @@ protected:
     TestCaseDriver driver = createDriver(MultipleTestCasesConfig());
     TestCaseDriver driverWithMultipleTestCases = createDriver(multipleTestCasesConfig);
     TestCaseDriver driverWithMultipleTestCasesWithOutputPrefix = createDriver(multipleTestCasesConfigWithOutputPrefix);
+    TestCaseDriver driverWithAggregates = createDriver(multipleTestCasesConfigWithAggregates);
 
     TestCaseDriver createDriver(MultipleTestCasesConfig multipleTestCasesConfig) {
         return {&rawIOManipulator, &ioManipulator, &verifier, multipleTestCasesConfig};
@@ -85,6 +99,19 @@ protected:
 
 int TestCaseDriverTests::T;
 int TestCaseDriverTests::N;
+long long TestCaseDriverTests::SumN;
+long long TestCaseDriverTests::MaxN;
+long long TestCaseDriverTests::CountLargeN;
+
+TEST_F(TestCaseDriverTests, SetThreads) {
+    EXPECT_CALL(ioManipulator, setThreads(4));
+    driver.setThreads(4);
+}
+
+TEST_F(TestCaseDriverTests, SetCheckSubtaskAssignment) {
+    EXPECT_CALL(verifier, setCheckSubtaskAssignment(false));
+    driver.setCheckSubtaskAssignment(false);
+}
 
 TEST_F(TestCaseDriverTests, GenerateInput_Sample) {
     {
@@ -119,6 +146,31 @@ TEST_F(TestCaseDriverTests, GenerateInput_Failed_Verification) {
     }
 }
 
+TEST_F(TestCaseDriverTests, GenerateInput_Failed_StreamedVectorPredicate) {
+    StreamedVector<int> A([](int x) {return x % 2 == 0;});
+    IOFormatBuilder ioFormatBuilder;
+    ioFormatBuilder.prepareForInputFormat();
+    ioFormatBuilder.newLineIOSegment()
+            .addVectorVariable(Vector::create(A, "A"));
+    IOManipulator streamingIOManipulator(ioFormatBuilder.build());
+    TestCaseDriver streamingDriver(&rawIOManipulator, &streamingIOManipulator, &verifier, MultipleTestCasesConfig());
+
+    TestCase testCase = TestCaseBuilder()
+            .setName("foo_1")
+            .setSubtaskIds({Subtask::MAIN_ID})
+            .setData(new OfficialTestCaseData([&] {A.produce(3, [](int i) {return i * 2 + (i == 2);});}))
+            .build();
+
+    try {
+        streamingDriver.generateInput(testCase, out);
+        FAIL();
+    } catch (FormattedError& e) {
+        EXPECT_THAT(e, Eq(FormattedError({
+                {0, "Does not satisfy constraints, on:"},
+                {1, "Element 'A[2]' does not satisfy its predicate"}})));
+    }
+}
+
 TEST_F(TestCaseDriverTests, GenerateSampleOutput) {
     {
         InSequence sequence;
@@ -134,6 +186,17 @@ TEST_F(TestCaseDriverTests, ValidateOutput) {
     driver.validateOutput(&in);
 }
 
+TEST_F(TestCaseDriverTests, ValidateOutput_WithInput) {
+    istringstream input("42\n");
+    istringstream output("yes\n");
+    {
+        InSequence sequence;
+        EXPECT_CALL(ioManipulator, parseInput(Truly(InputStreamContentIs("42\n"))));
+        EXPECT_CALL(ioManipulator, parseOutput(Truly(InputStreamContentIs("yes\n"))));
+    }
+    driver.validateOutput(&input, &output);
+}
+
 TEST_F(TestCaseDriverTests, GenerateInput_MultipleTestCases_Sample) {
     {
         InSequence sequence;
@@ -188,6 +251,17 @@ TEST_F(TestCaseDriverTests, ValidateOutput_MultipleTestCases_WithOutputPrefix) {
     driverWithMultipleTestCasesWithOutputPrefix.validateOutput(&in);
 }
 
+TEST_F(TestCaseDriverTests, ValidateOutput_WithInput_MultipleTestCases_WithOutputPrefix) {
+    istringstream input("1\n42\n");
+    istringstream output("Case #1: yes\n");
+    {
+        InSequence sequence;
+        EXPECT_CALL(ioManipulator, parseInput(Truly(InputStreamContentIs("42\n"))));
+        EXPECT_CALL(ioManipulator, parseOutput(Truly(InputStreamContentIs("yes\n"))));
+    }
+    driverWithMultipleTestCasesWithOutputPrefix.validateOutput(&input, &output);
+}
+
 TEST_F(TestCaseDriverTests, ValidateOutput_MultipleTestCases_WithOutputPrefix_Failed) {
     istringstream in("yes\n");
     try {
@@ -204,6 +278,26 @@ TEST_F(TestCaseDriverTests, ValidateMultipleTestCasesInput) {
     EXPECT_THAT(T, Eq(3));
 }
 
+TEST_F(TestCaseDriverTests, ValidateMultipleTestCasesInput_WithAggregates) {
+    driverWithAggregates.resetMultipleTestCasesAggregates();
+    driverWithAggregates.generateInput(officialTestCase2, out);
+    driverWithAggregates.generateInput(officialTestCase, out);
+    driverWithAggregates.generateInput(officialTestCase2, out);
+
+    driverWithAggregates.validateMultipleTestCasesInput(3);
+    EXPECT_THAT(T, Eq(3));
+    EXPECT_THAT(SumN, Eq(56));
+    EXPECT_THAT(MaxN, Eq(42));
+    EXPECT_THAT(CountLargeN, Eq(1));
+
+    driverWithAggregates.resetMultipleTestCasesAggregates();
+    driverWithAggregates.generateInput(officialTestCase2, out);
+    driverWithAggregates.validateMultipleTestCasesInput(1);
+    EXPECT_THAT(SumN, Eq(7));
+    EXPECT_THAT(MaxN, Eq(7));
+    EXPECT_THAT(CountLargeN, Eq(0));
+}
+
 TEST_F(TestCaseDriverTests, ValidateMultipleTestCasesInput_Failed) {
     MultipleTestCasesConstraintsVerificationResult failedResult({"desc"});
     ON_CALL(verifier, verifyMultipleTestCasesConstraints())
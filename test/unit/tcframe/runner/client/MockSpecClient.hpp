@@ -11,13 +11,18 @@ public:
     MockSpecClient()
             : SpecClient(nullptr, nullptr) {}
 
-    MOCK_METHOD0(getTestSuite, TestSuite());
+    MOCK_METHOD0(getTestSuite, const TestSuite&());
     MOCK_METHOD1(setSeed, void(unsigned));
+    MOCK_METHOD1(setThreads, void(int));
+    MOCK_METHOD1(setCheckSubtaskAssignment, void(bool));
     MOCK_METHOD0(hasMultipleTestCases, bool());
     MOCK_METHOD0(getMultipleTestCasesOutputPrefix, optional<string>());
     MOCK_METHOD2(generateTestCaseInput, void(const string&, const string&));
+    MOCK_METHOD1(waitForTestCaseInput, uint64_t(const string&));
     MOCK_METHOD2(generateSampleTestCaseOutput, void(const string&, const string&));
     MOCK_METHOD1(validateTestCaseOutput, void(const string&));
+    MOCK_METHOD2(validateTestCaseOutput, void(const string&, const string&));
+    MOCK_METHOD0(resetMultipleTestCasesAggregates, void());
     MOCK_METHOD1(validateMultipleTestCasesInput, void(int));
 };
 
@@ -0,0 +1,116 @@
+#include "gmock/gmock.h"
+#include "../../mock.hpp"
+
+#include <cstdio>
+
+#include "../../driver/MockSpecDriver.hpp"
+#include "../os/MockOperatingSystem.hpp"
+#include "tcframe/runner/client/RemoteSpecClient.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::fclose;
+using std::rewind;
+using std::tmpfile;
+
+namespace tcframe {
+
+class RemoteSpecClientTests : public Test {
+protected:
+    MOCK(SpecDriver) specDriver;
+    MOCK(OperatingSystem) os;
+
+    FILE* requests = tmpfile();
+    FILE* responses = tmpfile();
+
+    SpecDriverChannel channel = {responses, requests};
+    RemoteSpecClient client = {&specDriver, &os, &channel};
+
+    void TearDown() {
+        fclose(requests);
+        fclose(responses);
+    }
+
+    void respond(const vector<vector<string>>& responseList) {
+        SpecDriverChannel sender(nullptr, responses);
+        for (const vector<string>& response : responseList) {
+            sender.send(response);
+        }
+        rewind(responses);
+    }
+
+    vector<vector<string>> getRequests() {
+        rewind(requests);
+        SpecDriverChannel receiver(requests, nullptr);
+        vector<vector<string>> requestList;
+        vector<string> request;
+        while (receiver.receive(request)) {
+            requestList.push_back(request);
+        }
+        return requestList;
+    }
+};
+
+TEST_F(RemoteSpecClientTests, Calls) {
+    respond(vector<vector<string>>(9, {"ok"}));
+    EXPECT_CALL(specDriver, setSeed(_)).Times(0);
+    EXPECT_CALL(specDriver, generateTestCaseInput(_, _)).Times(0);
+    EXPECT_CALL(os, openForBackgroundWriting(_)).Times(0);
+
+    client.setSeed(42);
+    client.setThreads(4);
+    client.setCheckSubtaskAssignment(true);
+    client.resetMultipleTestCasesAggregates();
+    client.generateTestCaseInput("foo_1", "dir/foo_1.in");
+    client.generateSampleTestCaseOutput("foo_sample_1", "dir/foo_sample_1.out");
+    client.validateTestCaseOutput("dir/foo_1.out");
+    client.validateTestCaseOutput("dir/foo_1.in", "dir/foo_1.out");
+    client.validateMultipleTestCasesInput(3);
+
+    EXPECT_THAT(getRequests(), Eq(vector<vector<string>>{
+            {"setSeed", "42"},
+            {"setThreads", "4"},
+            {"setCheckSubtaskAssignment", "1"},
+            {"resetMultipleTestCasesAggregates"},
+            {"generateTestCaseInput", "foo_1", "dir/foo_1.in"},
+            {"generateSampleTestCaseOutput", "foo_sample_1", "dir/foo_sample_1.out"},
+            {"validateTestCaseOutput", "dir/foo_1.out"},
+            {"validateTestCaseOutput", "dir/foo_1.in", "dir/foo_1.out"},
+            {"validateMultipleTestCasesInput", "3"}}));
+}
+
+TEST_F(RemoteSpecClientTests, HasMultipleTestCases_Local) {
+    ON_CALL(specDriver, hasMultipleTestCases())
+            .WillByDefault(testing::Return(true));
+    EXPECT_TRUE(client.hasMultipleTestCases());
+    EXPECT_THAT(getRequests(), Eq(vector<vector<string>>{}));
+}
+
+TEST_F(RemoteSpecClientTests, Errors) {
+    respond({
+            {"error", "Unknown test case: foo_3"},
+            {"formatted_error", "0", "Constraints not satisfied:", "1", "1 <= T"}});
+
+    try {
+        client.generateTestCaseInput("foo_3", "dir/foo_3.in");
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(string(e.what()), Eq("Unknown test case: foo_3"));
+    }
+    try {
+        client.validateMultipleTestCasesInput(0);
+        FAIL();
+    } catch (FormattedError& e) {
+        EXPECT_THAT(e, Eq(FormattedError({{0, "Constraints not satisfied:"}, {1, "1 <= T"}})));
+    }
+    try {
+        client.setSeed(42);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(string(e.what()), Eq("Spec driver process terminated unexpectedly"));
+    }
+}
+
+}
@@ -12,7 +12,9 @@ using ::testing::_;
 using ::testing::Eq;
 using ::testing::InSequence;
 using ::testing::Return;
+using ::testing::ReturnRef;
 using ::testing::Test;
+using ::testing::Throw;
 
 using std::istringstream;
 using std::ostringstream;
@@ -32,15 +34,19 @@ protected:
     void SetUp() {
         ON_CALL(os, openForReading(_))
                 .WillByDefault(Return(in));
+        ON_CALL(os, openForMappedReading(_))
+                .WillByDefault(Return(in));
         ON_CALL(os, openForWriting(_))
                 .WillByDefault(Return(out));
+        ON_CALL(os, openForBackgroundWriting(_))
+                .WillByDefault(Return(out));
     }
 };
 
 TEST_F(SpecClientTests, GetTestSuite) {
     TestSuite testSuite({TestGroup(-1, {})});
     ON_CALL(specDriver, getTestSuite())
-            .WillByDefault(Return(testSuite));
+            .WillByDefault(ReturnRef(testSuite));
     EXPECT_THAT(client.getTestSuite(), Eq(testSuite));
 }
 
@@ -49,6 +55,16 @@ TEST_F(SpecClientTests, SetSeed) {
     client.setSeed(42);
 }
 
+TEST_F(SpecClientTests, SetThreads) {
+    EXPECT_CALL(specDriver, setThreads(4));
+    client.setThreads(4);
+}
+
+TEST_F(SpecClientTests, SetCheckSubtaskAssignment) {
+    EXPECT_CALL(specDriver, setCheckSubtaskAssignment(false));
+    client.setCheckSubtaskAssignment(false);
+}
+
 TEST_F(SpecClientTests, HasMultipleTestCases) {
     ON_CALL(specDriver, hasMultipleTestCases())
             .WillByDefault(Return(true));
@@ -64,11 +80,47 @@ TEST_F(SpecClientTests, GetMultipleTestCasesOutputPrefix) {
 TEST_F(SpecClientTests, GenerateTestCaseInput) {
     {
         InSequence sequence;
-        EXPECT_CALL(os, openForWriting("foo_1.out"));
+        EXPECT_CALL(os, openForBackgroundWriting("foo_1.in"));
         EXPECT_CALL(specDriver, generateTestCaseInput("foo_1", out));
         EXPECT_CALL(os, closeOpenedStream(out));
     }
-    client.generateTestCaseInput("foo_1", "foo_1.out");
+    EXPECT_CALL(os, waitForBackgroundWriting(_)).Times(0);
+    client.generateTestCaseInput("foo_1", "foo_1.in");
+}
+
+TEST_F(SpecClientTests, WaitForTestCaseInput) {
+    ON_CALL(os, waitForBackgroundWriting("foo_1.in"))
+            .WillByDefault(Return(optional<uint64_t>(42)));
+    EXPECT_CALL(os, openForReading(_)).Times(0);
+    EXPECT_THAT(client.waitForTestCaseInput("foo_1.in"), Eq(42));
+}
+
+TEST_F(SpecClientTests, WaitForTestCaseInput_NotWrittenInBackground) {
+    istringstream expectedIn("42\n");
+    uint64_t expectedHash = ContentHasher::hash(&expectedIn);
+
+    ON_CALL(os, openForReading("foo_1.in"))
+            .WillByDefault(Return(new istringstream("42\n")));
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, waitForBackgroundWriting("foo_1.in"));
+        EXPECT_CALL(os, openForReading("foo_1.in"));
+        EXPECT_CALL(os, closeOpenedStream(_));
+    }
+    EXPECT_THAT(client.waitForTestCaseInput("foo_1.in"), Eq(expectedHash));
+}
+
+TEST_F(SpecClientTests, GenerateTestCaseInput_Failed) {
+    ON_CALL(specDriver, generateTestCaseInput(_, _))
+            .WillByDefault(Throw(runtime_error("An error")));
+    EXPECT_CALL(os, closeOpenedStream(out));
+
+    try {
+        client.generateTestCaseInput("foo_1", "foo_1.in");
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(string(e.what()), Eq("An error"));
+    }
 }
 
 TEST_F(SpecClientTests, GenerateSampleTestCaseOutput) {
@@ -84,7 +136,7 @@ TEST_F(SpecClientTests, GenerateSampleTestCaseOutput) {
 TEST_F(SpecClientTests, ValidateTestCaseOutput) {
     {
         InSequence sequence;
-        EXPECT_CALL(os, openForReading("foo_1.out"));
+        EXPECT_CALL(os, openForMappedReading("foo_1.out"));
         EXPECT_CALL(specDriver, validateTestCaseOutput(in));
         EXPECT_CALL(os, closeOpenedStream(in));
 
@@ -92,6 +144,22 @@ TEST_F(SpecClientTests, ValidateTestCaseOutput) {
     client.validateTestCaseOutput("foo_1.out");
 }
 
+TEST_F(SpecClientTests, ValidateTestCaseOutput_WithInput) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForMappedReading("foo_1.in"));
+        EXPECT_CALL(os, openForMappedReading("foo_1.out"));
+        EXPECT_CALL(specDriver, validateTestCaseOutput(in, in));
+        EXPECT_CALL(os, closeOpenedStream(in)).Times(2);
+    }
+    client.validateTestCaseOutput("foo_1.in", "foo_1.out");
+}
+
+TEST_F(SpecClientTests, ResetMultipleTestCasesAggregates) {
+    EXPECT_CALL(specDriver, resetMultipleTestCasesAggregates());
+    client.resetMultipleTestCasesAggregates();
+}
+
 TEST_F(SpecClientTests, ValidateMultipleTestCasesInput) {
     EXPECT_CALL(specDriver, validateMultipleTestCasesInput(3));
     client.validateMultipleTestCasesInput(3);
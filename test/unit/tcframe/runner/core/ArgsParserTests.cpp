@@ -14,27 +14,36 @@ TEST_F(ArgsParserTests, Parsing_AllOptions) {
     char* argv[] = {
             (char*) "./runner",
             (char*) "--brief",
+            (char*) "--collapse-duplicates",
             (char*) "--communicator=python Communicator.py",
+            (char*) "--jobs=8",
             (char*) "--memory-limit=128",
             (char*) "--output=my/testdata",
             (char*) "--scorer=python Scorer.py",
             (char*) "--seed=42",
             (char*) "--solution=python Sol.py",
+            (char*) "--spec-driver-process",
+            (char*) "--threads=4",
             (char*) "--time-limit=3",
             nullptr};
     int argc = sizeof(argv) / sizeof(char*) - 1;
 
     Args args = ArgsParser::parse(argc, argv);
     EXPECT_TRUE(args.brief());
+    EXPECT_TRUE(args.collapseDuplicates());
     EXPECT_FALSE(args.noMemoryLimit());
+    EXPECT_FALSE(args.noSubtaskAssignmentCheck());
     EXPECT_FALSE(args.noTimeLimit());
+    EXPECT_TRUE(args.specDriverProcess());
 
     EXPECT_THAT(args.communicator(), Eq(optional<string>("python Communicator.py")));
+    EXPECT_THAT(args.jobs(), Eq(optional<int>(8)));
     EXPECT_THAT(args.memoryLimit(), Eq(optional<int>(128)));
     EXPECT_THAT(args.output(), Eq(optional<string>("my/testdata")));
     EXPECT_THAT(args.scorer(), Eq(optional<string>("python Scorer.py")));
     EXPECT_THAT(args.seed(), Eq(optional<unsigned>(42)));
     EXPECT_THAT(args.solution(), Eq(optional<string>("python Sol.py")));
+    EXPECT_THAT(args.threads(), Eq(optional<int>(4)));
     EXPECT_THAT(args.timeLimit(), Eq(optional<int>(3)));
 }
 
@@ -42,6 +51,7 @@ TEST_F(ArgsParserTests, Parsing_SomeOptions) {
     char* argv[] = {
             (char*) "./runner",
             (char*) "--no-memory-limit",
+            (char*) "--no-subtask-assignment-check",
             (char*) "--no-time-limit",
             (char*) "--output=my/testdata",
             (char*) "--seed=42",
@@ -50,11 +60,22 @@ TEST_F(ArgsParserTests, Parsing_SomeOptions) {
 
     Args args = ArgsParser::parse(argc, argv);
     EXPECT_FALSE(args.brief());
+    EXPECT_FALSE(args.collapseDuplicates());
     EXPECT_TRUE(args.noMemoryLimit());
+    EXPECT_TRUE(args.noSubtaskAssignmentCheck());
     EXPECT_TRUE(args.noTimeLimit());
     EXPECT_THAT(args.output(), Eq(optional<string>("my/testdata")));
     EXPECT_THAT(args.seed(), Eq(optional<unsigned>(42)));
     EXPECT_THAT(args.solution(), Eq(optional<string>()));
+    EXPECT_FALSE(args.specDriverProcess());
+}
+
+TEST_F(ArgsParserTests, Parsing_DriverCommand) {
+    char* argv[] = {(char*) "./runner", (char*) "driver", nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_THAT(args.command(), Eq(Args::Command::DRIVER));
 }
 
 TEST_F(ArgsParserTests, Parsing_MissingOptionArgument) {
@@ -1,6 +1,7 @@
 #include "gmock/gmock.h"
 #include "../../mock.hpp"
 
+#include <cstdio>
 #include <utility>
 
 #include "../../driver/MockDriver.hpp"
@@ -25,6 +26,7 @@ using ::testing::Test;
 using ::testing::Throw;
 using ::testing::Truly;
 
+using std::make_pair;
 using std::move;
 
 namespace tcframe {
@@ -62,7 +64,7 @@ protected:
         ON_CALL(runnerLoggerFactory, create(_)).WillByDefault(Return(&runnerLogger));
         ON_CALL(graderLoggerFactory, create(_, _)).WillByDefault(Return(&graderLogger));
         ON_CALL(generatorFactory, create(_, _, _, _)).WillByDefault(Return(&generator));
-        ON_CALL(graderFactory, create(_, _, _, _)).WillByDefault(Return(&grader));
+        ON_CALL(graderFactory, create(_, _, _, _, _)).WillByDefault(Return(&grader));
         ON_CALL(evaluatorRegistry, get(_, _, _)).WillByDefault(Return(&evaluator));
         ON_CALL(aggregatorRegistry, get(_)).WillByDefault(Return(&aggregator));
         ON_CALL(os, execute(_)).WillByDefault(Return(ExecutionResult()));
@@ -103,19 +103,53 @@ TEST_F(RunnerTests, Run_Generation_UseConfigOptions) {
 TEST_F(RunnerTests, Run_Generation_UseArgsOptions) {
     EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
             .setSeed(42)
+            .setThreads(4)
+            .setJobs(8)
+            .setCheckSubtaskAssignment(false)
             .setSolutionCommand("\"java Solution\"")
             .setOutputDir("testdata")
             .setHasTcOutput(false)
             .build()));
 
-    runnerWithConfig.run(4, new char*[5]{
+    runnerWithConfig.run(7, new char*[8]{
             (char*) "./runner",
             (char*) "--seed=42",
+            (char*) "--threads=4",
+            (char*) "--jobs=8",
+            (char*) "--no-subtask-assignment-check",
             (char*) "--solution=\"java Solution\"",
             (char*) "--output=testdata",
             nullptr});
 }
 
+TEST_F(RunnerTests, Run_Generation_SpecDriverProcess) {
+    FILE* in = tmpfile();
+    FILE* out = tmpfile();
+    EXPECT_CALL(os, startProcess("./runner", vector<string>{"driver"}))
+            .WillOnce(Return(make_pair(in, out)));
+    EXPECT_CALL(generatorFactory, create(Truly([] (SpecClient* specClient) {
+        return dynamic_cast<RemoteSpecClient*>(specClient) != nullptr;
+    }), _, _, _));
+
+    runner.run(2, new char*[3]{(char*) "./runner", (char*) "--spec-driver-process", nullptr});
+    fclose(in);
+    fclose(out);
+}
+
+TEST_F(RunnerTests, Run_Driver) {
+    FILE* in = tmpfile();
+    FILE* out = tmpfile();
+    EXPECT_CALL(os, takeStandardStreams())
+            .WillOnce(Return(make_pair(in, out)));
+    EXPECT_CALL(generatorFactory, create(_, _, _, _)).Times(0);
+    EXPECT_CALL(generator, generate(_)).Times(0);
+    EXPECT_CALL(os, execute(_)).Times(0);
+
+    EXPECT_THAT(runner.run(2, new char*[3]{(char*) "./runner", (char*) "driver", nullptr}), Eq(0));
+    fclose(in);
+    fclose(out);
+}
+
 TEST_F(RunnerTests, Run_Grading) {
     EXPECT_CALL(grader, grade(_));
 
@@ -127,6 +161,19 @@ TEST_F(RunnerTests, Run_Grading) {
     EXPECT_THAT(exitStatus, Eq(0));
 }
 
+TEST_F(RunnerTests, Run_Grading_SpecDriverProcess) {
+    EXPECT_CALL(os, startProcess(_, _)).Times(0);
+    EXPECT_CALL(graderFactory, create(Truly([] (SpecClient* specClient) {
+        return dynamic_cast<RemoteSpecClient*>(specClient) == nullptr;
+    }), _, _, _, _));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--spec-driver-process",
+            nullptr});
+}
+
 TEST_F(RunnerTests, Run_Grading_UseDefaultOptions) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
             .setTimeLimit(GradingConfig::DEFAULT_TIME_LIMIT)
@@ -159,17 +206,19 @@ TEST_F(RunnerTests, Run_Grading_UseArgsOptions) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
             .setSolutionCommand("\"java Solution\"")
             .setOutputDir("testdata")
+            .setCollapseDuplicates(true)
             .setTimeLimit(4)
             .setMemoryLimit(256)
             .build()));
 
-    runnerWithConfig.run(6, new char*[7]{
+    runnerWithConfig.run(7, new char*[8]{
             (char*) "./runner",
             (char*) "grade",
             (char*) "--solution=\"java Solution\"",
             (char*) "--output=testdata",
             (char*) "--time-limit=4",
             (char*) "--memory-limit=256",
+            (char*) "--collapse-duplicates",
             nullptr});
 }
 
@@ -87,4 +87,18 @@ TEST_F(DefaultGeneratorLoggerTests, MultipleTestCasesCombinationResult_Failed) {
     logger.logMultipleTestCasesCombinationFailedResult();
 }
 
+TEST_F(DefaultGeneratorLoggerTests, DuplicateTestCases) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Found duplicate test cases:"));
+        EXPECT_CALL(engine, logParagraph(1, "Identical inputs:"));
+        EXPECT_CALL(engine, logParagraph(2, "foo_1_1: N = 1"));
+        EXPECT_CALL(engine, logParagraph(2, "foo_1_3"));
+    }
+    logger.logDuplicateTestCases({{
+            TestCaseBuilder().setName("foo_1_1").setDescription("N = 1").build(),
+            TestCaseBuilder().setName("foo_1_3").build()}});
+}
+
 }
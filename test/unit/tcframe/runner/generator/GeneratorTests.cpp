@@ -1,6 +1,8 @@
 #include "gmock/gmock.h"
 #include "../../mock.hpp"
 
+#include <functional>
+
 #include "../client/MockSpecClient.hpp"
 #include "../os/MockOperatingSystem.hpp"
 #include "../../util/TestUtils.hpp"
@@ -11,12 +13,16 @@
 using ::testing::_;
 using ::testing::Eq;
 using ::testing::InSequence;
+using ::testing::Invoke;
 using ::testing::Pointee;
 using ::testing::Return;
+using ::testing::ReturnRef;
 using ::testing::Test;
 using ::testing::Throw;
 using ::testing::WhenDynamicCastTo;
 
+using std::hash;
+
 namespace tcframe {
 
 class GeneratorTests : public Test {
@@ -43,6 +49,7 @@ protected:
 
     GenerationOptions options = GenerationOptionsBuilder("foo")
             .setSeed(42)
+            .setThreads(4)
             .setSolutionCommand("python Sol.py")
             .setOutputDir("dir")
             .setHasTcOutput(true)
@@ -55,18 +62,24 @@ protected:
                 .WillByDefault(Return(false));
         ON_CALL(specClient, getMultipleTestCasesOutputPrefix())
                 .WillByDefault(Return(optional<string>()));
+
+        // By default, no two test cases have identical inputs.
         ON_CALL(testCaseGenerator, generate(_, _))
-                .WillByDefault(Return(true));
+                .WillByDefault(Invoke([](const TestCase& testCase, const GenerationOptions&) {
+                    return optional<uint64_t>(hash<string>()(testCase.name()));
+                }));
     }
 };
 
 TEST_F(GeneratorTests, Generation) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(simpleTestSuite));
+            .WillByDefault(ReturnRef(simpleTestSuite));
     {
         InSequence sequence;
         EXPECT_CALL(logger, logIntroduction());
         EXPECT_CALL(specClient, setSeed(42));
+        EXPECT_CALL(specClient, setThreads(4));
+        EXPECT_CALL(specClient, setCheckSubtaskAssignment(true));
         EXPECT_CALL(os, forceMakeDir("dir"));
 
         EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
@@ -80,7 +93,7 @@ TEST_F(GeneratorTests, Generation) {
 
 TEST_F(GeneratorTests, Generation_MultipleTestGroups) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuite));
+            .WillByDefault(ReturnRef(testSuite));
     {
         InSequence sequence;
         EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
@@ -92,9 +105,9 @@ TEST_F(GeneratorTests, Generation_MultipleTestGroups) {
 
 TEST_F(GeneratorTests, Generation_Failed) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(simpleTestSuite));
+            .WillByDefault(ReturnRef(simpleTestSuite));
     ON_CALL(testCaseGenerator, generate(stc1, _))
-            .WillByDefault(Return(false));
+            .WillByDefault(Return(optional<uint64_t>()));
 
     EXPECT_CALL(logger, logFailedResult());
 
@@ -103,7 +116,7 @@ TEST_F(GeneratorTests, Generation_Failed) {
 
 TEST_F(GeneratorTests, Generation_MultipleTestCases) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(simpleTestSuite));
+            .WillByDefault(ReturnRef(simpleTestSuite));
     ON_CALL(specClient, hasMultipleTestCases())
             .WillByDefault(Return(true));
     {
@@ -112,6 +125,7 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases) {
         EXPECT_CALL(os, forceMakeDir("dir"));
 
         EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(specClient, resetMultipleTestCasesAggregates());
         EXPECT_CALL(testCaseGenerator, generate(stc1, options));
         EXPECT_CALL(testCaseGenerator, generate(stc2, options));
         EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_sample"));
@@ -125,7 +139,7 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases) {
 
 TEST_F(GeneratorTests, Generation_MultipleTestCases_MultipleTestGroups) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuite));
+            .WillByDefault(ReturnRef(testSuite));
     ON_CALL(specClient, hasMultipleTestCases())
             .WillByDefault(Return(true));
     {
@@ -142,7 +156,7 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases_MultipleTestGroups) {
 
 TEST_F(GeneratorTests, Generation_MultipleTestCases_Failed_Verification) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(simpleTestSuite));
+            .WillByDefault(ReturnRef(simpleTestSuite));
     ON_CALL(specClient, hasMultipleTestCases())
             .WillByDefault(Return(true));
     MultipleTestCasesConstraintsVerificationResult verificationResult({"T <= 20"});
@@ -159,4 +173,39 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases_Failed_Verification) {
     EXPECT_FALSE(generator.generate(options));
 }
 
+TEST_F(GeneratorTests, Generation_DuplicateTestCases) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(ReturnRef(testSuite));
+    ON_CALL(testCaseGenerator, generate(tc1, _))
+            .WillByDefault(Return(optional<uint64_t>(1)));
+    ON_CALL(testCaseGenerator, generate(tc3, _))
+            .WillByDefault(Return(optional<uint64_t>(1)));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logDuplicateTestCases(vector<vector<TestCase>>{{tc1, tc3}}));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_TRUE(generator.generate(options));
+}
+
+TEST_F(GeneratorTests, Generation_DuplicateTestCases_None) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(ReturnRef(testSuite));
+
+    EXPECT_CALL(logger, logDuplicateTestCases(_)).Times(0);
+    EXPECT_TRUE(generator.generate(options));
+}
+
+TEST_F(GeneratorTests, Generation_DuplicateTestCases_SkipsFailed) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(ReturnRef(testSuite));
+    ON_CALL(testCaseGenerator, generate(_, _))
+            .WillByDefault(Return(optional<uint64_t>(1)));
+    ON_CALL(testCaseGenerator, generate(tc3, _))
+            .WillByDefault(Return(optional<uint64_t>()));
+
+    EXPECT_CALL(logger, logDuplicateTestCases(vector<vector<TestCase>>{{stc1, stc2, tc1, tc2}}));
+    EXPECT_FALSE(generator.generate(options));
+}
+
 }
@@ -19,6 +19,7 @@ public:
     MOCK_METHOD1(logMultipleTestCasesCombinationIntroduction, void(const string&));
     MOCK_METHOD0(logMultipleTestCasesCombinationSuccessfulResult, void());
     MOCK_METHOD0(logMultipleTestCasesCombinationFailedResult, void());
+    MOCK_METHOD1(logDuplicateTestCases, void(const vector<vector<TestCase>>&));
     MOCK_METHOD1(logError, void(runtime_error*));
 };
 
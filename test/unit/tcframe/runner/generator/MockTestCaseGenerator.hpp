@@ -11,7 +11,7 @@ public:
     MockTestCaseGenerator()
             : TestCaseGenerator(nullptr, nullptr, nullptr) {}
 
-    MOCK_METHOD2(generate, bool(const TestCase&, const GenerationOptions&));
+    MOCK_METHOD2(generate, optional<uint64_t>(const TestCase&, const GenerationOptions&));
 };
 
 }
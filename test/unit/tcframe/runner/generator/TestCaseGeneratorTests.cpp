@@ -10,6 +10,7 @@
 #include "tcframe/runner/generator/TestCaseGenerator.hpp"
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::Eq;
 using ::testing::InSequence;
 using ::testing::Pointee;
@@ -22,6 +23,7 @@ using ::testing::WhenDynamicCastTo;
 using std::istringstream;
 using std::move;
 using std::ostringstream;
+using std::vector;
 
 namespace tcframe {
 
@@ -56,13 +58,29 @@ protected:
     GenerationOptions noOutputOptions = GenerationOptionsBuilder(options)
             .setHasTcOutput(false)
             .build();
+    GenerationOptions pipelinedOptions = GenerationOptionsBuilder(options)
+            .setJobs(2)
+            .build();
     EvaluationOptions evaluationOptions = EvaluationOptionsBuilder()
             .setSolutionCommand("python Sol.py")
             .build();
 
     TestCaseGenerator generator = {&specClient, &evaluator, &logger};
 
+    optional<uint64_t> inputHash = optional<uint64_t>(42);
+    optional<uint64_t> noInputHash;
+
+    static TestCase createOfficialTestCase(int id) {
+        return TestCaseBuilder()
+                .setName("foo_" + StringUtils::toString(id))
+                .setDescription("N = " + StringUtils::toString(id))
+                .setData(new OfficialTestCaseData([=]{N = id;}))
+                .build();
+    }
+
     void SetUp() {
+        ON_CALL(specClient, waitForTestCaseInput(_))
+                .WillByDefault(Return(42));
         ON_CALL(evaluator, generate(_, _, _))
                 .WillByDefault(Return(GenerationResult(optional<Verdict>(), ExecutionResult())));
         ON_CALL(evaluator, score(_, _))
@@ -159,11 +177,12 @@ TEST_F(TestCaseGeneratorTests, Generation_Official) {
         InSequence sequence;
         EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
         EXPECT_CALL(specClient, generateTestCaseInput("foo_1", "dir/foo_1.in"));
+        EXPECT_CALL(specClient, waitForTestCaseInput("dir/foo_1.in"));
         EXPECT_CALL(evaluator, generate("dir/foo_1.in", "dir/foo_1.out", evaluationOptions));
         EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_1.out"));
         EXPECT_CALL(logger, logTestCaseSuccessfulResult());
     }
-    EXPECT_TRUE(generator.generate(officialTestCase, options));
+    EXPECT_THAT(generator.generate(officialTestCase, options), Eq(inputHash));
 }
 
 TEST_F(TestCaseGeneratorTests, Generation_Official_NoOutput) {
@@ -190,6 +209,19 @@ TEST_F(TestCaseGeneratorTests, Generation_Failed_InputGeneration) {
     EXPECT_FALSE(generator.generate(officialTestCase, options));
 }
 
+TEST_F(TestCaseGeneratorTests, Generation_Failed_InputWriting) {
+    string message = "Cannot write dir/foo_1.in";
+    ON_CALL(specClient, waitForTestCaseInput(_))
+            .WillByDefault(Throw(runtime_error(message)));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseFailedResult(optional<string>("N = 42")));
+        EXPECT_CALL(logger, logError(Truly(SimpleErrorMessageIs(message))));
+    }
+    EXPECT_CALL(evaluator, generate(_, _, _)).Times(0);
+    EXPECT_FALSE(generator.generate(officialTestCase, options));
+}
+
 TEST_F(TestCaseGeneratorTests, Generation_Failed_OutputGeneration) {
     Verdict verdict(VerdictStatus::rte());
     auto executionResult = ExecutionResultBuilder().setExitCode(1).build();
@@ -217,4 +249,98 @@ TEST_F(TestCaseGeneratorTests, Generation_Failed_OutputValidation) {
     EXPECT_FALSE(generator.generate(officialTestCase, options));
 }
 
+TEST_F(TestCaseGeneratorTests, Generation_Pipelined) {
+    vector<TestCase> testCases = {createOfficialTestCase(1), createOfficialTestCase(2), createOfficialTestCase(3)};
+    {
+        InSequence sequence;
+        EXPECT_CALL(specClient, generateTestCaseInput("foo_1", "dir/foo_1.in"));
+        EXPECT_CALL(specClient, waitForTestCaseInput("dir/foo_1.in"));
+        EXPECT_CALL(specClient, generateTestCaseInput("foo_2", "dir/foo_2.in"));
+        EXPECT_CALL(specClient, waitForTestCaseInput("dir/foo_2.in"));
+        EXPECT_CALL(specClient, generateTestCaseInput("foo_3", "dir/foo_3.in"));
+        EXPECT_CALL(specClient, waitForTestCaseInput("dir/foo_3.in"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+        EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_1.in", "dir/foo_1.out"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2"));
+        EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_2.in", "dir/foo_2.out"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3"));
+        EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_3.in", "dir/foo_3.out"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+    }
+    EXPECT_CALL(evaluator, generate("dir/foo_1.in", "dir/foo_1.out", evaluationOptions));
+    EXPECT_CALL(evaluator, generate("dir/foo_2.in", "dir/foo_2.out", evaluationOptions));
+    EXPECT_CALL(evaluator, generate("dir/foo_3.in", "dir/foo_3.out", evaluationOptions));
+    EXPECT_CALL(specClient, validateTestCaseOutput(_)).Times(0);
+
+    EXPECT_THAT(generator.generate(testCases, pipelinedOptions), Eq(vector<optional<uint64_t>>{inputHash, inputHash, inputHash}));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Pipelined_WithSample) {
+    vector<TestCase> testCases = {createOfficialTestCase(1), sampleTestCase, createOfficialTestCase(2)};
+    {
+        InSequence sequence;
+        EXPECT_CALL(specClient, generateTestCaseInput("foo_1", "dir/foo_1.in"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+        EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_1.in", "dir/foo_1.out"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(specClient, generateTestCaseInput("foo_sample_1", "dir/foo_sample_1.in"));
+        EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_sample_1.out"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(specClient, generateTestCaseInput("foo_2", "dir/foo_2.in"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2"));
+        EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_2.in", "dir/foo_2.out"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+    }
+    EXPECT_THAT(generator.generate(testCases, pipelinedOptions), Eq(vector<optional<uint64_t>>{inputHash, inputHash, inputHash}));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Pipelined_Failed) {
+    vector<TestCase> testCases = {createOfficialTestCase(1), createOfficialTestCase(2), createOfficialTestCase(3)};
+    auto executionResult = ExecutionResultBuilder().setExitCode(1).build();
+    ON_CALL(specClient, generateTestCaseInput("foo_1", _))
+            .WillByDefault(Throw(runtime_error("input error")));
+    ON_CALL(evaluator, generate("dir/foo_2.in", _, _))
+            .WillByDefault(Return(GenerationResult(optional<Verdict>(Verdict(VerdictStatus::rte())), executionResult)));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+        EXPECT_CALL(logger, logTestCaseFailedResult(optional<string>("N = 1")));
+        EXPECT_CALL(logger, logError(Truly(SimpleErrorMessageIs("input error"))));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2"));
+        EXPECT_CALL(logger, logTestCaseFailedResult(optional<string>("N = 2")));
+        EXPECT_CALL(logger, logError(
+                WhenDynamicCastTo<FormattedError*>(Pointee(
+                        ExecutionResults::asFormattedError({{"solution", executionResult}})))));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+    }
+    EXPECT_CALL(evaluator, generate(_, _, _)).Times(AnyNumber());
+    EXPECT_CALL(evaluator, generate("dir/foo_1.in", _, _)).Times(0);
+    EXPECT_CALL(specClient, validateTestCaseOutput(_, _)).Times(AnyNumber());
+    EXPECT_CALL(specClient, validateTestCaseOutput("dir/foo_2.in", _)).Times(0);
+
+    EXPECT_THAT(generator.generate(testCases, pipelinedOptions), Eq(vector<optional<uint64_t>>{noInputHash, noInputHash, inputHash}));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Pipelined_Failed_InputWriting) {
+    vector<TestCase> testCases = {createOfficialTestCase(1), createOfficialTestCase(2)};
+    ON_CALL(specClient, waitForTestCaseInput("dir/foo_1.in"))
+            .WillByDefault(Throw(runtime_error("Cannot write dir/foo_1.in")));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+        EXPECT_CALL(logger, logTestCaseFailedResult(optional<string>("N = 1")));
+        EXPECT_CALL(logger, logError(Truly(SimpleErrorMessageIs("Cannot write dir/foo_1.in"))));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+    }
+    EXPECT_CALL(evaluator, generate("dir/foo_1.in", _, _)).Times(0);
+    EXPECT_CALL(evaluator, generate("dir/foo_2.in", _, _));
+
+    EXPECT_THAT(generator.generate(testCases, pipelinedOptions), Eq(vector<optional<uint64_t>>{noInputHash, inputHash}));
+}
+
 }
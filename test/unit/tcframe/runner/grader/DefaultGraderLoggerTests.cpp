@@ -28,6 +28,12 @@ TEST_F(DefaultGraderLoggerTests, TestCaseVerdict) {
     logger.logTestCaseVerdict(Verdict(VerdictStatus::ac()));
 }
 
+TEST_F(DefaultGraderLoggerTests, TestCaseDuplicateVerdict) {
+    EXPECT_CALL(engine, logParagraph(0, VerdictStatus::ac().name() + " (same input as foo_1)"));
+
+    logger.logTestCaseDuplicateVerdict(Verdict(VerdictStatus::ac()), "foo_1");
+}
+
 TEST_F(DefaultGraderLoggerTests, Result) {
     Verdict verdict(VerdictStatus::ac());
     {
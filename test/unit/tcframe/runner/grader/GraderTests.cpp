@@ -1,9 +1,12 @@
 #include "gmock/gmock.h"
 #include "../../mock.hpp"
 
+#include <sstream>
+
 #include "../../util/TestUtils.hpp"
 #include "../aggregator/MockAggregator.hpp"
 #include "../client/MockSpecClient.hpp"
+#include "../os/MockOperatingSystem.hpp"
 #include "MockTestCaseGrader.hpp"
 #include "MockGraderLogger.hpp"
 #include "tcframe/runner/grader/Grader.hpp"
@@ -11,11 +14,15 @@
 using ::testing::_;
 using ::testing::Eq;
 using ::testing::InSequence;
+using ::testing::Invoke;
 using ::testing::Property;
 using ::testing::Return;
+using ::testing::ReturnRef;
 using ::testing::StartsWith;
 using ::testing::Test;
 
+using std::istringstream;
+
 namespace tcframe {
 
 class GraderTests : public Test {
@@ -25,6 +32,7 @@ protected:
     MOCK(SpecClient) specClient;
     MOCK(TestCaseGrader) testCaseGrader;
     MOCK(Aggregator) aggregator;
+    MOCK(OperatingSystem) os;
     MOCK(GraderLogger) logger;
 
     TestCase stcA = TestUtils::newSampleTestCase("foo_sample_1");
@@ -74,7 +82,7 @@ protected:
             .setSubtaskPoints({40, 50})
             .build();
 
-    Grader grader = {&specClient, &testCaseGrader, &aggregator, &logger};
+    Grader grader = {&specClient, &testCaseGrader, &aggregator, &os, &logger};
 
     void SetUp() {
         ON_CALL(specClient, hasMultipleTestCases())
@@ -88,6 +96,18 @@ protected:
         ON_CALL(testCaseGrader, grade(tc1, _)).WillByDefault(Return(tc1Verdict));
         ON_CALL(testCaseGrader, grade(tc2, _)).WillByDefault(Return(tc2Verdict));
         ON_CALL(testCaseGrader, grade(tc3, _)).WillByDefault(Return(tc3Verdict));
+
+        // The official test cases have identical inputs.
+        ON_CALL(os, openForReading(_))
+                .WillByDefault(Invoke([](const string& filename) {
+                    return new istringstream(filename.find("sample") == string::npos ? "1" : filename);
+                }));
+        ON_CALL(os, openForMappedReading(_))
+                .WillByDefault(Invoke([](const string& filename) {
+                    return new istringstream(filename.find("sample") == string::npos ? "1" : filename);
+                }));
+        ON_CALL(os, closeOpenedStream(_))
+                .WillByDefault(Invoke([](ios* stream) { delete stream; }));
     }
 };
 
@@ -95,7 +115,7 @@ int GraderTests::T;
 
 TEST_F(GraderTests, Grading) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuite));
+            .WillByDefault(ReturnRef(testSuite));
     {
         InSequence sequence;
         EXPECT_CALL(logger, logIntroduction("python Sol.py"));
@@ -118,7 +138,7 @@ TEST_F(GraderTests, Grading) {
 
 TEST_F(GraderTests, Grading_MultipleTestCases) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuite));
+            .WillByDefault(ReturnRef(testSuite));
     ON_CALL(specClient, hasMultipleTestCases())
             .WillByDefault(Return(true));
     {
@@ -143,7 +163,7 @@ TEST_F(GraderTests, Grading_MultipleTestCases) {
 
 TEST_F(GraderTests, Grading_WithoutSample_MultipleTestCases) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuiteWithoutSample));
+            .WillByDefault(ReturnRef(testSuiteWithoutSample));
     ON_CALL(specClient, hasMultipleTestCases())
             .WillByDefault(Return(true));
     {
@@ -167,7 +187,7 @@ TEST_F(GraderTests, Grading_WithoutSample_MultipleTestCases) {
 
 TEST_F(GraderTests, Grading_WithSubtasks) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuiteWithSubtasks));
+            .WillByDefault(ReturnRef(testSuiteWithSubtasks));
     {
         InSequence sequence;
         EXPECT_CALL(logger, logIntroduction("python Sol.py"));
@@ -193,9 +213,60 @@ TEST_F(GraderTests, Grading_WithSubtasks) {
     grader.grade(optionsWithSubtasks);
 }
 
+TEST_F(GraderTests, Grading_WithSubtasks_CollapseDuplicates) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(ReturnRef(testSuiteWithSubtasks));
+    GradingOptions optionsWithCollapse = GradingOptionsBuilder(optionsWithSubtasks)
+            .setCollapseDuplicates(true)
+            .build();
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseGrader, grade(stc1, optionsWithCollapse));
+        EXPECT_CALL(testCaseGrader, grade(stc2, optionsWithCollapse));
+        EXPECT_CALL(testCaseGrader, grade(tc1, optionsWithCollapse));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(logger, logTestCaseDuplicateVerdict(tc1Verdict, "foo_1_1"));
+        EXPECT_CALL(testCaseGrader, grade(tc3, optionsWithCollapse));
+
+        EXPECT_CALL(aggregator, aggregate(vector<Verdict>{stc1Verdict, tc1Verdict, tc1Verdict}, 40))
+                .WillOnce(Return(subtask1Verdict));
+        EXPECT_CALL(aggregator, aggregate(
+                vector<Verdict>{stc1Verdict, stc2Verdict, tc1Verdict, tc1Verdict, tc3Verdict}, 50))
+                .WillOnce(Return(subtask2Verdict));
+    }
+    EXPECT_CALL(testCaseGrader, grade(tc2, _)).Times(0);
+    grader.grade(optionsWithCollapse);
+}
+
+TEST_F(GraderTests, Grading_WithSubtasks_CollapseDuplicates_SameHashOnly) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(ReturnRef(testSuiteWithSubtasks));
+    GradingOptions optionsWithCollapse = GradingOptionsBuilder(optionsWithSubtasks)
+            .setCollapseDuplicates(true)
+            .build();
+
+    // The inputs have the same hash, but different contents.
+    ON_CALL(os, openForMappedReading(_))
+            .WillByDefault(Invoke([](const string& filename) {
+                return new istringstream(filename);
+            }));
+    ON_CALL(aggregator, aggregate(_, _))
+            .WillByDefault(Return(subtask1Verdict));
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseGrader, grade(stc1, optionsWithCollapse));
+        EXPECT_CALL(testCaseGrader, grade(stc2, optionsWithCollapse));
+        EXPECT_CALL(testCaseGrader, grade(tc1, optionsWithCollapse));
+        EXPECT_CALL(testCaseGrader, grade(tc2, optionsWithCollapse));
+        EXPECT_CALL(testCaseGrader, grade(tc3, optionsWithCollapse));
+    }
+    EXPECT_CALL(logger, logTestCaseDuplicateVerdict(_, _)).Times(0);
+    grader.grade(optionsWithCollapse);
+}
+
 TEST_F(GraderTests, Grading_WithSubtasks_MultipleTestCases) {
     ON_CALL(specClient, getTestSuite())
-            .WillByDefault(Return(testSuiteWithSubtasks));
+            .WillByDefault(ReturnRef(testSuiteWithSubtasks));
     ON_CALL(specClient, hasMultipleTestCases())
             .WillByDefault(Return(true));
     {
@@ -14,6 +14,7 @@ public:
 
     MOCK_METHOD1(logIntroduction, void(const string&));
     MOCK_METHOD1(logTestCaseVerdict, void(const Verdict&));
+    MOCK_METHOD2(logTestCaseDuplicateVerdict, void(const Verdict&, const string&));
     MOCK_METHOD2(logResult, void(const map<int, Verdict>&, const Verdict&));
 };
 
@@ -0,0 +1,85 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/runner/os/BackgroundWriter.hpp"
+#include "tcframe/util.hpp"
+
+using ::testing::Eq;
+using ::testing::Le;
+using ::testing::Test;
+
+using std::istringstream;
+
+namespace tcframe {
+
+class BackgroundWriterTests : public Test {
+protected:
+    // Records the chunks instead of writing them.
+    class RecordingBackgroundWriter : public BackgroundWriter {
+    public:
+        vector<string> filenames;
+        vector<string> chunks;
+        vector<bool> firsts;
+        vector<bool> lasts;
+        uint64_t contentHash = 0;
+
+        void write(const string& filename, string data, bool isFirst, bool isLast, uint64_t contentHash) {
+            filenames.push_back(filename);
+            chunks.push_back(data);
+            firsts.push_back(isFirst);
+            lasts.push_back(isLast);
+            if (isLast) {
+                this->contentHash = contentHash;
+            }
+        }
+    };
+
+    RecordingBackgroundWriter writer;
+
+    static uint64_t hash(const string& content) {
+        istringstream in(content);
+        return ContentHasher::hash(&in);
+    }
+};
+
+TEST_F(BackgroundWriterTests, Stream) {
+    BackgroundWriterStream out(&writer, "foo_1.in");
+    out << 42 << ' ' << "abc" << '\n';
+    EXPECT_THAT(out.filename(), Eq("foo_1.in"));
+    EXPECT_THAT(writer.chunks.size(), Eq(0));
+
+    out.close();
+    out.close();
+    EXPECT_THAT(writer.filenames, Eq(vector<string>{"foo_1.in"}));
+    EXPECT_THAT(writer.chunks, Eq(vector<string>{"42 abc\n"}));
+    EXPECT_THAT(writer.firsts, Eq(vector<bool>{true}));
+    EXPECT_THAT(writer.lasts, Eq(vector<bool>{true}));
+    EXPECT_THAT(writer.contentHash, Eq(hash("42 abc\n")));
+}
+
+TEST_F(BackgroundWriterTests, Stream_Large) {
+    string expected;
+    BackgroundWriterStream out(&writer, "foo_1.in");
+    for (int i = 0; i < 300000; i++) {
+        out << i << '\n';
+        expected += StringUtils::toString(i) + "\n";
+    }
+    string block(3 * BackgroundWriter::CHUNK_SIZE / 2, 'x');
+    out << block;
+    expected += block;
+    out.close();
+
+    string actual;
+    for (int i = 0; i < writer.chunks.size(); i++) {
+        EXPECT_THAT(writer.chunks[i].size(), Le(BackgroundWriter::CHUNK_SIZE));
+        EXPECT_THAT(writer.firsts[i], Eq(i == 0));
+        EXPECT_THAT(writer.lasts[i], Eq(i + 1 == writer.chunks.size()));
+        actual += writer.chunks[i];
+    }
+    EXPECT_THAT(writer.chunks.size(), Eq(expected.size() / BackgroundWriter::CHUNK_SIZE + 1));
+    EXPECT_THAT(actual, Eq(expected));
+    EXPECT_THAT(writer.contentHash, Eq(hash(expected)));
+}
+
+}
@@ -0,0 +1,53 @@
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "tcframe/runner/os/ContentHasher.hpp"
+#include "tcframe/util.hpp"
+
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::Test;
+
+using std::istringstream;
+using std::min;
+using std::string;
+
+namespace tcframe {
+
+class ContentHasherTests : public Test {
+protected:
+    static uint64_t hash(const string& content) {
+        istringstream in(content);
+        return ContentHasher::hash(&in);
+    }
+};
+
+TEST_F(ContentHasherTests, SameContent) {
+    EXPECT_THAT(hash("3\n1 2 3\n"), Eq(hash("3\n1 2 3\n")));
+    EXPECT_THAT(hash(string(200000, 'x')), Eq(hash(string(200000, 'x'))));
+}
+
+TEST_F(ContentHasherTests, DifferentContent) {
+    EXPECT_THAT(hash("3\n1 2 3\n"), Ne(hash("3\n1 2 4\n")));
+    EXPECT_THAT(hash("1"), Ne(hash("1\n")));
+    EXPECT_THAT(hash(""), Ne(hash(string(1, '\0'))));
+    EXPECT_THAT(hash(string(8, '\0')), Ne(hash(string(16, '\0'))));
+}
+
+TEST_F(ContentHasherTests, Incremental) {
+    string content;
+    for (int i = 0; i < 1000; i++) {
+        content += StringUtils::toString(i) + " ";
+    }
+
+    ContentHasher hasher;
+    for (size_t i = 0, size = 1; i < content.size(); i += size, size = size % 13 + 1) {
+        hasher.update(content.data() + i, min(size, content.size() - i));
+    }
+    EXPECT_THAT(hasher.digest(), Eq(hash(content)));
+    EXPECT_THAT(ContentHasher().digest(), Eq(hash("")));
+}
+
+}
@@ -9,11 +9,16 @@ namespace tcframe {
 class MockOperatingSystem : public OperatingSystem {
 public:
     MOCK_METHOD1(openForReading, istream*(const string&));
+    MOCK_METHOD1(openForMappedReading, istream*(const string&));
     MOCK_METHOD1(openForWriting, ostream*(const string&));
+    MOCK_METHOD1(openForBackgroundWriting, ostream*(const string&));
+    MOCK_METHOD1(waitForBackgroundWriting, optional<uint64_t>(const string&));
     MOCK_METHOD1(closeOpenedStream, void(ios*));
     MOCK_METHOD1(forceMakeDir, void(const string&));
     MOCK_METHOD1(removeFile, void(const string&));
     MOCK_METHOD1(execute, ExecutionResult(const ExecutionRequest&));
+    MOCK_METHOD2(startProcess, pair<FILE*, FILE*>(const string&, const vector<string>&));
+    MOCK_METHOD0(takeStandardStreams, pair<FILE*, FILE*>());
 };
 
 }
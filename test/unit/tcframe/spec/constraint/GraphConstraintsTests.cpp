@@ -0,0 +1,70 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/constraint/GraphConstraints.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class GraphConstraintsTests : public Test {};
+
+TEST_F(GraphConstraintsTests, InvalidEdges) {
+    EXPECT_THAT(GraphConstraints::isConnected(3, vector<int>{1, 2}, vector<int>{2}),
+            Eq(ConstraintResult::violated("the edge lists have different sizes")));
+    EXPECT_THAT(GraphConstraints::isConnected(3, vector<int>{1, 2}, vector<int>{2, 4}),
+            Eq(ConstraintResult::violated("edge [1] (2, 4) has a vertex out of range")));
+    EXPECT_THAT(GraphConstraints::isConnected(3, vector<int>{0, 1}, vector<int>{1, 2}),
+            Eq(ConstraintResult::violated("edge [0] (0, 1) has a vertex out of range")));
+    EXPECT_TRUE(GraphConstraints::isConnected(3, vector<int>{0, 1}, vector<int>{1, 2}, 0));
+}
+
+TEST_F(GraphConstraintsTests, IsSimpleGraph) {
+    EXPECT_TRUE(GraphConstraints::isSimpleGraph(3, vector<int>{1, 2, 3}, vector<int>{2, 3, 1}));
+    EXPECT_THAT(GraphConstraints::isSimpleGraph(3, vector<int>{1, 2}, vector<int>{2, 2}),
+            Eq(ConstraintResult::violated("edge [1] (2, 2) is a self-loop")));
+    EXPECT_THAT(GraphConstraints::isSimpleGraph(3, vector<int>{1, 2, 2}, vector<int>{2, 3, 1}),
+            Eq(ConstraintResult::violated("edge [2] (2, 1) is a multi-edge")));
+}
+
+TEST_F(GraphConstraintsTests, IsConnected) {
+    EXPECT_TRUE(GraphConstraints::isConnected(1, vector<int>{}, vector<int>{}));
+    EXPECT_TRUE(GraphConstraints::isConnected(4, vector<int>{1, 3, 4}, vector<int>{3, 4, 2}));
+    EXPECT_THAT(GraphConstraints::isConnected(4, vector<int>{1, 3}, vector<int>{3, 1}),
+            Eq(ConstraintResult::violated("vertex 2 is not reachable from vertex 1")));
+}
+
+TEST_F(GraphConstraintsTests, IsForest) {
+    EXPECT_TRUE(GraphConstraints::isForest(4, vector<int>{1, 3}, vector<int>{2, 4}));
+    EXPECT_THAT(GraphConstraints::isForest(4, vector<int>{1, 2, 3, 1}, vector<int>{2, 3, 4, 3}),
+            Eq(ConstraintResult::violated("edge [3] (1, 3) forms a cycle")));
+}
+
+TEST_F(GraphConstraintsTests, IsTree) {
+    EXPECT_TRUE(GraphConstraints::isTree(1, vector<int>{}, vector<int>{}));
+    EXPECT_TRUE(GraphConstraints::isTree(4, vector<int>{1, 1, 1}, vector<int>{2, 3, 4}));
+    EXPECT_THAT(GraphConstraints::isTree(4, vector<int>{1, 3}, vector<int>{2, 4}),
+            Eq(ConstraintResult::violated("has 2 edges instead of 3")));
+    EXPECT_THAT(GraphConstraints::isTree(4, vector<int>{1, 2, 1}, vector<int>{2, 1, 4}),
+            Eq(ConstraintResult::violated("edge [1] (2, 1) forms a cycle")));
+}
+
+TEST_F(GraphConstraintsTests, IsDAG) {
+    EXPECT_TRUE(GraphConstraints::isDAG(4, vector<int>{1, 1, 2, 3}, vector<int>{2, 3, 4, 4}));
+    EXPECT_THAT(GraphConstraints::isDAG(4, vector<int>{1, 2, 3, 3}, vector<int>{2, 3, 2, 4}),
+            Eq(ConstraintResult::violated("vertex 2 is on or reachable from a cycle")));
+}
+
+TEST_F(GraphConstraintsTests, IsTree_Large) {
+    int n = 200000;
+    vector<int> U, V;
+    for (int i = 2; i <= n; i++) {
+        U.push_back(i - 1);
+        V.push_back(i);
+    }
+    EXPECT_TRUE(GraphConstraints::isTree(n, U, V));
+    EXPECT_TRUE(GraphConstraints::isDAG(n, U, V));
+    EXPECT_TRUE(GraphConstraints::isSimpleGraph(n, U, V));
+}
+
+}
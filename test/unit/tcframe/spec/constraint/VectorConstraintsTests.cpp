@@ -0,0 +1,109 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/constraint/VectorConstraints.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class VectorConstraintsTests : public Test {};
+
+TEST_F(VectorConstraintsTests, EachElementBetween) {
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(vector<int>{}, 1, 10));
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(vector<int>{1, 5, 10}, 1, 10));
+    EXPECT_THAT(VectorConstraints::eachElementBetween(vector<int>{1, 11, 0}, 1, 10),
+            Eq(ConstraintResult::violated("at [1]: 11 is not between 1 and 10")));
+}
+
+TEST_F(VectorConstraintsTests, EachElementBetween_Large) {
+    vector<long long> v(5000, 7);
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(v, 7LL, 7LL));
+
+    v[4321] = 8;
+    EXPECT_THAT(VectorConstraints::eachElementBetween(v, 7LL, 7LL),
+            Eq(ConstraintResult::violated("at [4321]: 8 is not between 7 and 7")));
+}
+
+TEST_F(VectorConstraintsTests, EachElementBetween_MixedBoundTypes) {
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(vector<int>{1, 1000000000}, 1, 1e9));
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(vector<long long>{0, (long long) 1e18}, 0, (long long) 1e18));
+    EXPECT_THAT(VectorConstraints::eachElementBetween(vector<long long>{5, -1}, 0, 10LL),
+            Eq(ConstraintResult::violated("at [1]: -1 is not between 0 and 10")));
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(vector<vector<int>>{{1, 2}, {3}}, 1, 3LL));
+}
+
+TEST_F(VectorConstraintsTests, EachElementBetween_Matrix) {
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(vector<vector<int>>{{1, 2}, {3}}, 1, 3));
+    EXPECT_THAT(VectorConstraints::eachElementBetween(vector<vector<int>>{{1, 2}, {3, 4}}, 1, 3),
+            Eq(ConstraintResult::violated("at [1][1]: 4 is not between 1 and 3")));
+}
+
+TEST_F(VectorConstraintsTests, IsSorted) {
+    EXPECT_TRUE(VectorConstraints::isSorted(vector<int>{}));
+    EXPECT_TRUE(VectorConstraints::isSorted(vector<int>{1, 1, 2}));
+    EXPECT_THAT(VectorConstraints::isSorted(vector<int>{1, 3, 2, 0}),
+            Eq(ConstraintResult::violated("at [2]: 2 is less than 3")));
+}
+
+TEST_F(VectorConstraintsTests, IsStrictlySorted) {
+    EXPECT_TRUE(VectorConstraints::isStrictlySorted(vector<int>{1, 2, 3}));
+    EXPECT_THAT(VectorConstraints::isStrictlySorted(vector<int>{1, 2, 2}),
+            Eq(ConstraintResult::violated("at [2]: 2 is not greater than 2")));
+}
+
+TEST_F(VectorConstraintsTests, IsDistinct) {
+    EXPECT_TRUE(VectorConstraints::isDistinct(vector<string>{"a", "b", "c"}));
+    EXPECT_THAT(VectorConstraints::isDistinct(vector<int>{5, 3, 4, 3, 5}),
+            Eq(ConstraintResult::violated("at [3]: 3 already appears at [1]")));
+}
+
+TEST_F(VectorConstraintsTests, IsPermutation) {
+    EXPECT_TRUE(VectorConstraints::isPermutation(vector<int>{}));
+    EXPECT_TRUE(VectorConstraints::isPermutation(vector<int>{3, 1, 2}));
+    EXPECT_THAT(VectorConstraints::isPermutation(vector<int>{3, 1, 4}),
+            Eq(ConstraintResult::violated("at [2]: 4 is not between 1 and 3")));
+    EXPECT_THAT(VectorConstraints::isPermutation(vector<int>{2, 1, 2}),
+            Eq(ConstraintResult::violated("at [2]: 2 already appears at [0]")));
+}
+
+TEST_F(VectorConstraintsTests, IsPermutation_SizeBeyondElementType) {
+    vector<short> v(40000, 1);
+    for (int i = 0; i < 32767; i++) {
+        v[i] = (short) (i + 1);
+    }
+    EXPECT_THAT(VectorConstraints::isPermutation(v),
+            Eq(ConstraintResult::violated("at [32767]: 1 already appears at [0]")));
+}
+
+TEST_F(VectorConstraintsTests, SumBetween) {
+    EXPECT_TRUE(VectorConstraints::sumBetween(vector<int>{1, 2, 3}, 6, 6));
+    EXPECT_THAT(VectorConstraints::sumBetween(vector<int>{1000000000, 1000000000}, 1, 1000000000),
+            Eq(ConstraintResult::violated("sum is 2000000000, not between 1 and 1000000000")));
+    EXPECT_THAT(VectorConstraints::sumBetween(vector<long long>{(1LL << 62), (1LL << 62)}, 0, 1),
+            Eq(ConstraintResult::violated("sum overflows long long")));
+}
+
+TEST_F(VectorConstraintsTests, ProductAtMost) {
+    EXPECT_TRUE(VectorConstraints::productAtMost(vector<int>{2, 3, 4}, 24));
+    EXPECT_TRUE(VectorConstraints::productAtMost(vector<long long>{1LL << 40, 1LL << 40, 0}, 1));
+    EXPECT_THAT(VectorConstraints::productAtMost(vector<int>{2, 3, 4}, 23),
+            Eq(ConstraintResult::violated("product exceeds 23 at [2]")));
+    EXPECT_THAT(VectorConstraints::productAtMost(vector<int>{2, -3, 4}, 100),
+            Eq(ConstraintResult::violated("at [1]: -3 is negative")));
+}
+
+TEST_F(VectorConstraintsTests, ProductAtMost_ZeroAndEmpty) {
+    EXPECT_THAT(VectorConstraints::productAtMost(vector<int>{0, -3}, 100),
+            Eq(ConstraintResult::violated("at [1]: -3 is negative")));
+    EXPECT_THAT(VectorConstraints::productAtMost(vector<int>{-3, 0}, 100),
+            Eq(ConstraintResult::violated("at [0]: -3 is negative")));
+    EXPECT_TRUE(VectorConstraints::productAtMost(vector<int>{5, 0}, 0));
+    EXPECT_THAT(VectorConstraints::productAtMost(vector<int>{5, 0}, -1),
+            Eq(ConstraintResult::violated("product is 0, which exceeds -1")));
+    EXPECT_TRUE(VectorConstraints::productAtMost(vector<int>{}, 1));
+    EXPECT_THAT(VectorConstraints::productAtMost(vector<int>{}, 0),
+            Eq(ConstraintResult::violated("product is 1, which exceeds 0")));
+}
+
+}
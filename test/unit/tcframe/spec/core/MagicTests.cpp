@@ -37,6 +37,7 @@ protected:
         int N = 3;
         int A, B;
         vector<int> C, D;
+        StreamedVector<int> E;
 
         vector<vector<int>> bogus;
 
@@ -47,6 +48,8 @@ protected:
             LINE(A, B);
             LINE(C % SIZE(N));
             LINE(A, B, C % SIZE(3), D);
+            LINE(E % SIZE(N));
+            LINE(A, E);
         }
 
         void testInvalid_UnsupportedType() {
@@ -68,6 +71,7 @@ protected:
         vector<int> X, Y;
         vector<vector<int>> Z;
         vector<int> A, B;
+        StreamedVector<int> S;
 
         int bogus;
 
@@ -76,6 +80,7 @@ protected:
             LINES(X) % SIZE(2);
             LINES(X, Y) % SIZE(3);
             LINES(X, Y, Z) % SIZE(N);
+            LINES(S) % SIZE(N);
             LINES(A, B);
         }
 
@@ -132,6 +137,8 @@ protected:
         int R = 2;
         int C = 3;
         vector<vector<int>> M1, M2, M3, M4;
+        Grid<char> G;
+        BitGrid B;
 
         int bogus;
 
@@ -141,6 +148,8 @@ protected:
             GRID(M2) % SIZE(R, 3);
             GRID(M3) % SIZE(2, C);
             GRID(M4) % SIZE(R, C);
+            GRID(G) % SIZE(R, C);
+            GRID(B) % SIZE(R, C);
         }
 
         void testInvalid() {
@@ -187,6 +196,7 @@ TEST_F(MagicTests, LINE_Valid) {
 
     int dummy;
     vector<int> dummy2;
+    StreamedVector<int> dummy3;
     IOFormatBuilder builder;
     builder.prepareForInputFormat();
     builder.newLineIOSegment()
@@ -202,6 +212,11 @@ TEST_F(MagicTests, LINE_Valid) {
             .addScalarVariable(Scalar::create(dummy, "B"))
             .addVectorVariable(Vector::create(dummy2, "C"), [] {return 3;})
             .addVectorVariable(Vector::create(dummy2, "D"));
+    builder.newLineIOSegment()
+            .addVectorVariable(Vector::create(dummy3, "E"), [] {return 3;});
+    builder.newLineIOSegment()
+            .addScalarVariable(Scalar::create(dummy, "A"))
+            .addVectorVariable(Vector::create(dummy3, "E"));
 
     EXPECT_THAT(ioFormat, Eq(builder.build()));
 }
@@ -253,6 +268,7 @@ TEST_F(MagicTests, LINES_Valid) {
 
     vector<int> dummy;
     vector<vector<int>> dummy2;
+    StreamedVector<int> dummy3;
     IOFormatBuilder builder;
     builder.prepareForInputFormat();
     builder.newLinesIOSegment()
@@ -267,6 +283,9 @@ TEST_F(MagicTests, LINES_Valid) {
             .addVectorVariable(Vector::create(dummy, "Y"))
             .addJaggedVectorVariable(Matrix::create(dummy2, "Z"))
             .setSize([] {return 4;});
+    builder.newLinesIOSegment()
+            .addVectorVariable(Vector::create(dummy3, "S"))
+            .setSize([] {return 4;});
     builder.newLinesIOSegment()
             .addVectorVariable(Vector::create(dummy, "A"))
             .addVectorVariable(Vector::create(dummy, "B"))
@@ -383,6 +402,8 @@ TEST_F(MagicTests, GRID_Valid) {
     IOFormat ioFormat = tester.build();
 
     vector<vector<int>> dummy;
+    Grid<char> dummy2;
+    BitGrid dummy3;
     IOFormatBuilder builder;
     builder.prepareForInputFormat();
     builder.newGridIOSegment()
@@ -397,6 +418,12 @@ TEST_F(MagicTests, GRID_Valid) {
     builder.newGridIOSegment()
             .addMatrixVariable(Matrix::create(dummy, "M4"))
             .setSize([] {return 2;}, [] {return 3;});
+    builder.newGridIOSegment()
+            .addMatrixVariable(Matrix::create(dummy2, "G"))
+            .setSize([] {return 2;}, [] {return 3;});
+    builder.newGridIOSegment()
+            .addMatrixVariable(Matrix::create(dummy3, "B"))
+            .setSize([] {return 2;}, [] {return 3;});
 
     EXPECT_THAT(ioFormat, Eq(builder.build()));
 }
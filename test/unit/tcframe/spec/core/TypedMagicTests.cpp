@@ -0,0 +1,236 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#define TCFRAME_TYPED_IO
+#include "tcframe/spec/core.hpp"
+
+using ::testing::Eq;
+using ::testing::IsNull;
+using ::testing::Ne;
+using ::testing::NotNull;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class TypedMagicTests : public Test {
+protected:
+    class Tester : public IOFormatBuilder {
+    public:
+        int N, A;
+        vector<int> C;
+        vector<long long> D;
+        vector<int> X;
+        vector<string> Y;
+        vector<vector<int>> Z;
+        vector<vector<char>> G;
+        Grid<int> H;
+
+        vector<vector<int>> bogus;
+
+        void testTyped() {
+            prepareForInputFormat();
+            LINE(N, A);
+            LINE(C % SIZE(N), D);
+            LINES(X, Y, Z) % SIZE(N);
+            GRID(G) % SIZE(2, 3);
+            GRID(H) % SIZE(1, 2);
+        }
+
+        void testDynamic() {
+            prepareForInputFormat();
+            (MagicLineIOSegmentBuilder(newLineIOSegment(), "N, A"), N, A);
+            (MagicLineIOSegmentBuilder(newLineIOSegment(), "C % SIZE(N), D"), C % SIZE(N), D);
+            (MagicLinesIOSegmentBuilder(newLinesIOSegment(), "X, Y, Z"), X, Y, Z) % SIZE(N);
+            (MagicGridIOSegmentBuilder(newGridIOSegment(), "G"), G) % SIZE(2, 3);
+            (MagicGridIOSegmentBuilder(newGridIOSegment(), "H"), H) % SIZE(1, 2);
+        }
+
+        void testInvalid_UnsupportedType() {
+            LINE(N, bogus);
+        }
+    };
+
+    class StreamedTester : public IOFormatBuilder {
+    public:
+        int N;
+        StreamedVector<int> S = StreamedVector<int>([](int x) {return x > 0;});
+        StreamedVector<int> T;
+
+        void testTyped() {
+            prepareForInputFormat();
+            LINE(N);
+            LINE(S % SIZE(N));
+            LINES(T);
+        }
+    };
+
+    Tester typedTester;
+    Tester dynamicTester;
+
+    IOFormat typedIOFormat;
+    IOFormat dynamicIOFormat;
+
+    IOManipulator* typedManipulator;
+    IOManipulator* dynamicManipulator;
+
+    void SetUp() {
+        typedTester.testTyped();
+        dynamicTester.testDynamic();
+        typedIOFormat = typedTester.build();
+        dynamicIOFormat = dynamicTester.build();
+        typedManipulator = new IOManipulator(typedIOFormat);
+        dynamicManipulator = new IOManipulator(dynamicIOFormat);
+    }
+
+    static string printInput(IOManipulator* manipulator) {
+        ostringstream out;
+        manipulator->printInput(&out);
+        return out.str();
+    }
+
+    static string parseInput(IOManipulator* manipulator, const string& input) {
+        istringstream in(input);
+        try {
+            manipulator->parseInput(&in);
+        } catch (runtime_error& e) {
+            return e.what();
+        }
+        return "";
+    }
+
+    static void fill(Tester& tester) {
+        tester.N = 2;
+        tester.A = -5;
+        tester.C = {1, 2};
+        tester.D = {10000000000LL, 3};
+        tester.X = {4, 5};
+        tester.Y = {"ab", "cd"};
+        tester.Z = {{6, 7}, {}};
+        tester.G = {{'a', 'b', 'c'}, {'d', 'e', 'f'}};
+        tester.H = Grid<int>(1, 2, 8);
+    }
+};
+
+TEST_F(TypedMagicTests, TypedSegmentsAttached) {
+    const IOSegments& segments = typedIOFormat.inputFormat();
+    EXPECT_THAT(((LineIOSegment*) segments[0])->typedSegment(), NotNull());
+    EXPECT_THAT(((LineIOSegment*) segments[1])->typedSegment(), NotNull());
+    EXPECT_THAT(((LinesIOSegment*) segments[2])->typedSegment(), NotNull());
+    EXPECT_THAT(((GridIOSegment*) segments[3])->typedSegment(), NotNull());
+    EXPECT_THAT(((GridIOSegment*) segments[4])->typedSegment(), NotNull());
+
+    EXPECT_THAT(((LineIOSegment*) dynamicIOFormat.inputFormat()[0])->typedSegment(), IsNull());
+
+    fill(typedTester);
+    fill(dynamicTester);
+    EXPECT_THAT(typedIOFormat, Eq(dynamicIOFormat));
+}
+
+TEST_F(TypedMagicTests, Printing) {
+    fill(typedTester);
+    fill(dynamicTester);
+
+    string output = printInput(typedManipulator);
+    EXPECT_THAT(output, Eq(printInput(dynamicManipulator)));
+    EXPECT_THAT(output, Eq("2 -5\n1 2 10000000000 3\n4 ab 6 7\n5 cd\nabc\ndef\n8 8\n"));
+}
+
+TEST_F(TypedMagicTests, Printing_Failed) {
+    fill(typedTester);
+    fill(dynamicTester);
+    typedTester.C = dynamicTester.C = {1};
+
+    string typedMessage;
+    string dynamicMessage;
+    try {
+        printInput(typedManipulator);
+    } catch (runtime_error& e) {
+        typedMessage = e.what();
+    }
+    try {
+        printInput(dynamicManipulator);
+    } catch (runtime_error& e) {
+        dynamicMessage = e.what();
+    }
+    EXPECT_THAT(typedMessage, StrEq("Number of elements of vector 'C' unsatisfied. Expected: 2, actual: 1"));
+    EXPECT_THAT(typedMessage, StrEq(dynamicMessage));
+}
+
+TEST_F(TypedMagicTests, Parsing) {
+    string input = "2 -5\n1 2 10000000000 3\n4 ab 6 7\n5 cd\nabc\ndef\n8 8\n";
+    EXPECT_THAT(parseInput(typedManipulator, input), StrEq(""));
+
+    fill(dynamicTester);
+    EXPECT_THAT(typedTester.N, Eq(dynamicTester.N));
+    EXPECT_THAT(typedTester.A, Eq(dynamicTester.A));
+    EXPECT_THAT(typedTester.C, Eq(dynamicTester.C));
+    EXPECT_THAT(typedTester.D, Eq(dynamicTester.D));
+    EXPECT_THAT(typedTester.X, Eq(dynamicTester.X));
+    EXPECT_THAT(typedTester.Y, Eq(dynamicTester.Y));
+    EXPECT_THAT(typedTester.Z, Eq(dynamicTester.Z));
+    EXPECT_THAT(typedTester.G, Eq(dynamicTester.G));
+    EXPECT_THAT(typedTester.H, Eq(dynamicTester.H));
+}
+
+TEST_F(TypedMagicTests, Parsing_Failed) {
+    for (const string& input : {
+            "2\n",
+            "2 x\n",
+            "2 -5\n1 2\n",
+            "2 -5\n1  2 3\n",
+            "2 -5\n1 2 3 4\n4 ab 6 7\n",
+            "2 -5\n1 2 3 4\n4 ab 6 7\n5\n",
+            "2 -5\n1 2 3 4\n4 ab 6 7\n5 cd\nab\n",
+            "2 -5\n1 2 3 4\n4 ab 6 7\n5 cd\nabc\ndef",
+            "2 -5\n1 2 3 4\n4 ab 6 7\n5 cd\nabc\ndef\n8\n",
+            "2 -5\n1 2 3 4\n4 ab 6 7\n5 cd\nabc\ndef\n8 8\nextra\n"}) {
+        string typedMessage = parseInput(typedManipulator, input);
+        EXPECT_THAT(typedMessage, Eq(parseInput(dynamicManipulator, input))) << input;
+        EXPECT_THAT(typedMessage, Ne("")) << input;
+    }
+}
+
+TEST_F(TypedMagicTests, Parsing_StreamedVector) {
+    StreamedTester tester;
+    tester.testTyped();
+    IOFormat ioFormat = tester.build();
+    IOManipulator manipulator(ioFormat);
+
+    EXPECT_THAT(parseInput(&manipulator, "3\n1 2 3\n4\n5\n"), StrEq(""));
+    EXPECT_THAT(tester.S.size(), Eq(3));
+    EXPECT_THAT(tester.S.back(), Eq(3));
+    EXPECT_THAT(tester.T.size(), Eq(2));
+    EXPECT_THAT(tester.T.back(), Eq(5));
+
+    EXPECT_THAT(parseInput(&manipulator, "3\n1 0 3\n"), StrEq("Element 'S[1]' does not satisfy its predicate"));
+}
+
+TEST_F(TypedMagicTests, Printing_StreamedVector) {
+    StreamedTester tester;
+    tester.testTyped();
+    IOFormat ioFormat = tester.build();
+    IOManipulator manipulator(ioFormat);
+
+    tester.N = 3;
+    tester.S.produce(3, [](int i) {return i + 1;});
+    tester.T.produce(2, [](int i) {return 10 * i;});
+    EXPECT_THAT(printInput(&manipulator), Eq("3\n1 2 3\n0\n10\n"));
+}
+
+TEST_F(TypedMagicTests, Invalid_UnsupportedType) {
+    Tester tester;
+    tester.prepareForInputFormat();
+    try {
+        tester.testInvalid_UnsupportedType();
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("The type of variable 'bogus' is not supported for a line segment"));
+    }
+}
+
+}
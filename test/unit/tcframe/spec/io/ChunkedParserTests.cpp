@@ -0,0 +1,106 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <stdexcept>
+
+#include "tcframe/spec/io/ChunkedParser.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+using std::runtime_error;
+
+namespace tcframe {
+
+class ChunkedParserTests : public Test {
+protected:
+    static const int ROWS = 400000;
+
+    vector<int> X;
+    string input = createInput();
+
+    static string createInput() {
+        ostringstream out;
+        for (int i = 0; i < ROWS; i++) {
+            out << 1000000 + i << '\n';
+        }
+        return out.str();
+    }
+
+    bool parse(const ChunkedParser& parser, istream* in, int rows) {
+        return parser.tryParse(
+                in,
+                rows,
+                [&](int rows) {
+                    X.assign(rows, 0);
+                },
+                [&](istream* chunkIn, int begin, int end) {
+                    for (int j = begin; j < end; j++) {
+                        *chunkIn >> X[j];
+                        if (chunkIn->get() != '\n' || X[j] != 1000000 + j) {
+                            throw runtime_error("Invalid row " + StringUtils::toString(j));
+                        }
+                    }
+                });
+    }
+};
+
+TEST_F(ChunkedParserTests, Parsing) {
+    istringstream in(input + "rest");
+
+    EXPECT_TRUE(parse(ChunkedParser(4), &in, ROWS));
+    EXPECT_THAT(X.size(), Eq(ROWS));
+    EXPECT_THAT(X.back(), Eq(1000000 + ROWS - 1));
+
+    string rest;
+    in >> rest;
+    EXPECT_THAT(rest, Eq("rest"));
+}
+
+TEST_F(ChunkedParserTests, Parsing_SomeRows) {
+    istringstream in(input);
+
+    EXPECT_TRUE(parse(ChunkedParser(4), &in, 10));
+    EXPECT_THAT(X.size(), Eq(10));
+    EXPECT_THAT((int) in.tellg(), Eq(80));
+}
+
+TEST_F(ChunkedParserTests, Parsing_WithoutSize) {
+    istringstream in(input);
+
+    EXPECT_TRUE(parse(ChunkedParser(4), &in, NO_SIZE));
+    EXPECT_THAT(X.size(), Eq(ROWS));
+}
+
+TEST_F(ChunkedParserTests, Parsing_Failed_EarliestError) {
+    input[8 * (ROWS - 1)] = '2';
+    input[8 * (ROWS / 2)] = '2';
+    istringstream in(input);
+
+    try {
+        parse(ChunkedParser(4), &in, ROWS);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Invalid row " + StringUtils::toString(ROWS / 2)));
+    }
+}
+
+TEST_F(ChunkedParserTests, NotParsing) {
+    istringstream in(input);
+    EXPECT_FALSE(parse(ChunkedParser(1), &in, ROWS));
+    EXPECT_FALSE(parse(ChunkedParser(4), &in, ROWS + 1));
+
+    istringstream inWithoutLastNewline(input + "1");
+    EXPECT_FALSE(parse(ChunkedParser(4), &inWithoutLastNewline, NO_SIZE));
+
+    istringstream smallIn("1000000\n");
+    EXPECT_FALSE(parse(ChunkedParser(4), &smallIn, 1));
+
+    EXPECT_THAT((int) in.tellg(), Eq(0));
+    EXPECT_TRUE(X.empty());
+}
+
+}
@@ -0,0 +1,78 @@
+#include "gmock/gmock.h"
+
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "tcframe/spec/io/ChunkedPrinter.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::fixed;
+using std::ostringstream;
+using std::runtime_error;
+using std::setprecision;
+
+namespace tcframe {
+
+class ChunkedPrinterTests : public Test {
+protected:
+    static const int COUNT = 5 * ChunkedPrinter::CHUNK_SIZE + 7;
+
+    static void printItems(int begin, int end, ostream* out) {
+        for (int i = begin; i < end; i++) {
+            *out << i << '\n';
+        }
+    }
+
+    static string print(const ChunkedPrinter& printer, int count) {
+        ostringstream out;
+        printer.print(count, printItems, &out);
+        return out.str();
+    }
+};
+
+TEST_F(ChunkedPrinterTests, IsParallel) {
+    EXPECT_FALSE(ChunkedPrinter(1).isParallel(COUNT));
+    EXPECT_FALSE(ChunkedPrinter(4).isParallel(ChunkedPrinter::CHUNK_SIZE));
+    EXPECT_TRUE(ChunkedPrinter(4).isParallel(COUNT));
+}
+
+TEST_F(ChunkedPrinterTests, Printing_Parallel) {
+    string expected = print(ChunkedPrinter(1), COUNT);
+    EXPECT_THAT(print(ChunkedPrinter(2), COUNT), Eq(expected));
+    EXPECT_THAT(print(ChunkedPrinter(4), COUNT), Eq(expected));
+}
+
+TEST_F(ChunkedPrinterTests, Printing_Parallel_KeepsFormat) {
+    ostringstream out;
+    out << fixed << setprecision(2);
+    ChunkedPrinter(4).print(COUNT, [](int begin, int end, ostream* chunkOut) {
+        for (int i = begin; i < end; i++) {
+            *chunkOut << i * 0.5 << ' ';
+        }
+    }, &out);
+
+    EXPECT_THAT(out.str().substr(0, 20), StrEq("0.00 0.50 1.00 1.50 "));
+}
+
+TEST_F(ChunkedPrinterTests, Printing_Parallel_Failed) {
+    ostringstream out;
+
+    try {
+        ChunkedPrinter(4).print(COUNT, [](int begin, int end, ostream* chunkOut) {
+            if (begin <= 3 * ChunkedPrinter::CHUNK_SIZE && 3 * ChunkedPrinter::CHUNK_SIZE < end) {
+                throw runtime_error("failed at chunk 3");
+            }
+            printItems(begin, end, chunkOut);
+        }, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("failed at chunk 3"));
+    }
+    EXPECT_THAT(out.str(), Eq(print(ChunkedPrinter(1), 3 * ChunkedPrinter::CHUNK_SIZE)));
+}
+
+}
@@ -34,6 +34,54 @@ TEST_F(GridIOSegmentManipulatorTests, Parsing_Successful) {
     EXPECT_THAT(M, Eq(vector<vector<int>>{{1, 2, 3}, {4, 5, 6}}));
 }
 
+TEST_F(GridIOSegmentManipulatorTests, Parsing_Threads_Successful) {
+    int rows = 200000;
+    ostringstream out;
+    for (int r = 0; r < rows; r++) {
+        out << r << ' ' << r + 1 << ' ' << r + 2 << '\n';
+    }
+    out << "rest";
+    istringstream in(out.str());
+    GridIOSegment* largeSegment = GridIOSegmentBuilder()
+            .addMatrixVariable(Matrix::create(M, "M"))
+            .setSize([=] {return rows;}, columns)
+            .build();
+
+    manipulator.setThreads(4);
+    EXPECT_THAT(manipulator.parse(largeSegment, &in), Eq("'M[199999][2]'"));
+    EXPECT_THAT(M.size(), Eq(rows));
+    EXPECT_THAT(M[150000], Eq(vector<int>{150000, 150001, 150002}));
+
+    string rest;
+    in >> rest;
+    EXPECT_THAT(rest, Eq("rest"));
+}
+
+TEST_F(GridIOSegmentManipulatorTests, Parsing_Threads_Bool_Successful) {
+    int rows = 300000;
+    ostringstream out;
+    for (int r = 0; r < rows; r++) {
+        out << r % 2 << ' ' << (r / 2) % 2 << ' ' << 1 << ' ' << 0 << ' ' << r % 3 / 2 << '\n';
+    }
+    istringstream in(out.str());
+    Grid<bool> flags;
+    GridIOSegment* largeSegment = GridIOSegmentBuilder()
+            .addMatrixVariable(Matrix::create(flags, "flags"))
+            .setSize([=] {return rows;}, [] {return 5;})
+            .build();
+
+    manipulator.setThreads(8);
+    manipulator.parse(largeSegment, &in);
+    ASSERT_THAT(flags.rows(), Eq(rows));
+    for (int r = 0; r < rows; r++) {
+        ASSERT_THAT(flags[r][0], Eq(r % 2 == 1));
+        ASSERT_THAT(flags[r][1], Eq((r / 2) % 2 == 1));
+        ASSERT_THAT(flags[r][2], Eq(true));
+        ASSERT_THAT(flags[r][3], Eq(false));
+        ASSERT_THAT(flags[r][4], Eq(r % 3 == 2));
+    }
+}
+
 TEST_F(GridIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
     istringstream in("1 2 3\n4 5 6\n");
 
@@ -49,6 +97,25 @@ TEST_F(GridIOSegmentManipulatorTests, Printing_Successful) {
     EXPECT_THAT(out.str(), Eq("1 2 3\n4 5 6\n"));
 }
 
+TEST_F(GridIOSegmentManipulatorTests, Printing_Threads_Successful) {
+    int rows = 3 * ChunkedPrinter::CHUNK_SIZE + 1;
+    for (int r = 0; r < rows; r++) {
+        M.push_back({r, r + 1, r + 2});
+    }
+    GridIOSegment* largeSegment = GridIOSegmentBuilder()
+            .addMatrixVariable(Matrix::create(M, "M"))
+            .setSize([=] {return rows;}, columns)
+            .build();
+
+    ostringstream expected;
+    manipulator.print(largeSegment, &expected);
+
+    ostringstream out;
+    manipulator.setThreads(4);
+    manipulator.print(largeSegment, &out);
+    EXPECT_THAT(out.str(), Eq(expected.str()));
+}
+
 TEST_F(GridIOSegmentManipulatorTests, Printing_Failed_RowsMismatch) {
     ostringstream out;
 
@@ -190,6 +190,46 @@ TEST_F(IOManipulatorTests, Parsing_Output_Multiple_Failed) {
     }
 }
 
+TEST_F(IOManipulatorTests, Parsing_Output_Multiple_WithCommonSegments) {
+    IOFormatBuilder ioFormatBuilder;
+    ioFormatBuilder.setBeforeOutputFormat([] {});
+    ioFormatBuilder.newOutputFormat();
+    ioFormatBuilder.newLineIOSegment()
+            .addScalarVariable(Scalar::create(A, "A"));
+    ioFormatBuilder.newLinesIOSegment()
+            .addVectorVariable(Vector::create(U, "U"))
+            .setSize([=] {return A;});
+    ioFormatBuilder.newOutputFormat();
+    ioFormatBuilder.newLineIOSegment()
+            .addScalarVariable(Scalar::create(A, "A"));
+    ioFormatBuilder.newLinesIOSegment()
+            .addVectorVariable(Vector::create(V, "V"))
+            .setSize([=] {return A + 1;});
+    ioFormatBuilder.newOutputFormat();
+    ioFormatBuilder.newLineIOSegment()
+            .addScalarVariable(Scalar::create(A, "A"));
+    IOFormat ioFormat = ioFormatBuilder.build();
+
+    auto manipulatorWithCommonSegments = new IOManipulator(ioFormat);
+
+    istringstream in1("2\n1\n2\n3\n");
+    manipulatorWithCommonSegments->parseOutput(&in1);
+    EXPECT_THAT(A, Eq(2));
+    EXPECT_THAT(V, Eq((vector<int>{1, 2, 3})));
+
+    istringstream in2("7\n");
+    manipulatorWithCommonSegments->parseOutput(&in2);
+    EXPECT_THAT(A, Eq(7));
+
+    istringstream in3("x\n");
+    try {
+        manipulatorWithCommonSegments->parseOutput(&in3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Test case output does not conform to any of the output formats"));
+    }
+}
+
 TEST_F(IOManipulatorTests, Printing_Successful) {
     A = 123;
     S = "hello, world!";
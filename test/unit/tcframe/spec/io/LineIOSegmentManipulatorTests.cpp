@@ -300,6 +300,23 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Only_Succes
     EXPECT_THAT(out.str(), Eq("3 4 5\n"));
 }
 
+TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Threads_Successful) {
+    A = 1;
+    B = 2;
+    C = {3, 4};
+    for (int i = 0; i < 3 * ChunkedPrinter::CHUNK_SIZE + 1; i++) {
+        D.push_back(i);
+    }
+
+    ostringstream expected;
+    manipulator.print(segmentWithVectorWithoutSize, &expected);
+
+    ostringstream out;
+    manipulator.setThreads(4);
+    manipulator.print(segmentWithVectorWithoutSize, &out);
+    EXPECT_THAT(out.str(), Eq(expected.str()));
+}
+
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Only_Empty_Successful) {
     ostringstream out;
 
@@ -58,6 +58,53 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_Successful) {
     EXPECT_THAT(Y, Eq(vector<int>{2, 4, 6}));
 }
 
+TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Threads_Successful) {
+    ostringstream out;
+    for (int i = 0; i < 300000; i++) {
+        out << i << ' ' << -i << '\n';
+    }
+    istringstream in(out.str());
+
+    manipulator.setThreads(4);
+    EXPECT_THAT(manipulator.parse(segmentWithoutSize, &in), Eq("'Y[299999]'"));
+    EXPECT_THAT(X.size(), Eq(300000));
+    EXPECT_THAT(X[123456], Eq(123456));
+    EXPECT_THAT(Y[234567], Eq(-234567));
+    EXPECT_TRUE(WhitespaceManipulator::isEof(&in));
+}
+
+TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Threads_Failed) {
+    ostringstream out;
+    for (int i = 0; i < 300000; i++) {
+        if (i == 200000) {
+            out << i << "  x\n";
+        } else if (i == 100000) {
+            out << i << '\n';
+        } else {
+            out << i << ' ' << -i << '\n';
+        }
+    }
+    string input = out.str();
+
+    string sequentialMessage;
+    try {
+        istringstream in(input);
+        manipulator.parse(segmentWithoutSize, &in);
+    } catch (runtime_error& e) {
+        sequentialMessage = e.what();
+    }
+
+    try {
+        istringstream in(input);
+        manipulator.setThreads(4);
+        manipulator.parse(segmentWithoutSize, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'X[100000]'"));
+        EXPECT_THAT(e.what(), StrEq(sequentialMessage));
+    }
+}
+
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
     istringstream in("1 2\n3 4\n5 6\n");
 
@@ -307,6 +354,23 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Suc
     EXPECT_THAT(out.str(), Eq("1 2 10\n3 4\n5 6 20 30\n"));
 }
 
+TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Threads_Successful) {
+    int size = 3 * ChunkedPrinter::CHUNK_SIZE + 1;
+    for (int i = 0; i < size; i++) {
+        X.push_back(i);
+        Y.push_back(-i);
+        Z.push_back(vector<int>(i % 3, i));
+    }
+
+    ostringstream expected;
+    manipulator.print(segmentWithJaggedVectorWithoutSize, &expected);
+
+    ostringstream out;
+    manipulator.setThreads(4);
+    manipulator.print(segmentWithJaggedVectorWithoutSize, &out);
+    EXPECT_THAT(out.str(), Eq(expected.str()));
+}
+
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Only_Successful) {
     ostringstream out;
 
@@ -11,6 +11,7 @@ public:
     MockIOManipulator()
             : IOManipulator(IOFormat()) {}
 
+    MOCK_METHOD1(setThreads, void(int));
     MOCK_METHOD1(printInput, void(ostream*));
     MOCK_METHOD1(parseInput, void(istream*));
     MOCK_METHOD1(parseOutput, void(istream*));
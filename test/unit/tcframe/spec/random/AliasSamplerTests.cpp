@@ -0,0 +1,36 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/random/AliasSampler.hpp"
+
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Le;
+using ::testing::Test;
+
+namespace tcframe {
+
+class AliasSamplerTests : public Test {
+protected:
+    Random rnd;
+};
+
+TEST_F(AliasSamplerTests, Next) {
+    AliasSampler sampler({1, 0, 3});
+    vector<int> counts(3);
+    for (int i = 0; i < 40000; i++) {
+        counts[sampler.next(&rnd)]++;
+    }
+    EXPECT_THAT(counts[1], Eq(0));
+    EXPECT_THAT(counts[0], Ge(9000));
+    EXPECT_THAT(counts[0], Le(11000));
+    EXPECT_THAT(counts[2], Ge(29000));
+    EXPECT_THAT(counts[2], Le(31000));
+}
+
+TEST_F(AliasSamplerTests, Invalid) {
+    EXPECT_THROW(AliasSampler({}), runtime_error);
+    EXPECT_THROW(AliasSampler({0, 0}), runtime_error);
+    EXPECT_THROW(AliasSampler({1, -1}), runtime_error);
+}
+
+}
@@ -0,0 +1,152 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/random/GeometryGenerator.hpp"
+
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Gt;
+using ::testing::Le;
+using ::testing::Ne;
+using ::testing::Test;
+
+namespace tcframe {
+
+class GeometryGeneratorTests : public Test {
+protected:
+    Random rnd;
+    GeometryGenerator generator = GeometryGenerator(&rnd);
+    vector<long long> X, Y;
+
+    static long long cross(long long ax, long long ay, long long bx, long long by, long long cx, long long cy) {
+        return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+    }
+
+    static int sign(long long x) {
+        return (x > 0) - (x < 0);
+    }
+
+    static bool isOnSegment(long long ax, long long ay, long long bx, long long by, long long px, long long py) {
+        return min(ax, bx) <= px && px <= max(ax, bx) && min(ay, by) <= py && py <= max(ay, by);
+    }
+
+    static bool intersects(long long ax, long long ay, long long bx, long long by,
+                           long long cx, long long cy, long long dx, long long dy) {
+        int d1 = sign(cross(ax, ay, bx, by, cx, cy));
+        int d2 = sign(cross(ax, ay, bx, by, dx, dy));
+        int d3 = sign(cross(cx, cy, dx, dy, ax, ay));
+        int d4 = sign(cross(cx, cy, dx, dy, bx, by));
+        if (d1 * d2 < 0 && d3 * d4 < 0) {
+            return true;
+        }
+        return (d1 == 0 && isOnSegment(ax, ay, bx, by, cx, cy))
+               || (d2 == 0 && isOnSegment(ax, ay, bx, by, dx, dy))
+               || (d3 == 0 && isOnSegment(cx, cy, dx, dy, ax, ay))
+               || (d4 == 0 && isOnSegment(cx, cy, dx, dy, bx, by));
+    }
+
+    void expectNoThreeCollinear() {
+        int n = (int) X.size();
+        for (int i = 0; i < n; i++) {
+            for (int j = i + 1; j < n; j++) {
+                for (int k = j + 1; k < n; k++) {
+                    ASSERT_THAT(cross(X[i], Y[i], X[j], Y[j], X[k], Y[k]), Ne(0));
+                }
+            }
+        }
+    }
+
+    static void expectWithin(const vector<long long>& values, long long minCoord, long long maxCoord) {
+        for (long long value : values) {
+            EXPECT_THAT(value, Ge(minCoord));
+            EXPECT_THAT(value, Le(maxCoord));
+        }
+    }
+};
+
+TEST_F(GeometryGeneratorTests, NextPointsInGeneralPosition) {
+    for (long long maxCoord : {1000LL, 1000000000LL}) {
+        int n = 150;
+        generator.nextPointsInGeneralPosition(n, -maxCoord, maxCoord, X, Y);
+        ASSERT_THAT(X.size(), Eq(n));
+        ASSERT_THAT(Y.size(), Eq(n));
+        expectWithin(X, -maxCoord, maxCoord);
+        expectWithin(Y, -maxCoord, maxCoord);
+        expectNoThreeCollinear();
+    }
+}
+
+TEST_F(GeometryGeneratorTests, NextPointsInGeneralPosition_Tight) {
+    generator.nextPointsInGeneralPosition(7, 1, 7, X, Y);
+    expectWithin(X, 1, 7);
+    expectWithin(Y, 1, 7);
+    expectNoThreeCollinear();
+}
+
+TEST_F(GeometryGeneratorTests, NextPointsInGeneralPosition_Failed) {
+    EXPECT_THROW(generator.nextPointsInGeneralPosition(10, 1, 9, X, Y), runtime_error);
+}
+
+TEST_F(GeometryGeneratorTests, NextConvexPolygon) {
+    for (long long maxCoord : {1000LL, 1000000000LL}) {
+        for (int n : {3, 4, 10, 100}) {
+            generator.nextConvexPolygon(n, 0, maxCoord, X, Y);
+            ASSERT_THAT(X.size(), Eq(n));
+            ASSERT_THAT(Y.size(), Eq(n));
+            expectWithin(X, 0, maxCoord);
+            expectWithin(Y, 0, maxCoord);
+
+            // Strictly convex and counterclockwise: every other vertex is strictly left of every edge.
+            for (int i = 0; i < n; i++) {
+                int j = (i + 1) % n;
+                for (int k = 0; k < n; k++) {
+                    if (k != i && k != j) {
+                        ASSERT_THAT(cross(X[i], Y[i], X[j], Y[j], X[k], Y[k]), Gt(0));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(GeometryGeneratorTests, NextConvexPolygon_Failed) {
+    EXPECT_THROW(generator.nextConvexPolygon(2, 0, 100, X, Y), runtime_error);
+    EXPECT_THROW(generator.nextConvexPolygon(100, 0, 10, X, Y), runtime_error);
+}
+
+TEST_F(GeometryGeneratorTests, NextNonIntersectingSegments) {
+    vector<long long> X2, Y2;
+    for (long long maxCoord : {100LL, 1000000000LL}) {
+        int n = 50;
+        generator.nextNonIntersectingSegments(n, 1, maxCoord, X, Y, X2, Y2);
+        ASSERT_THAT(X.size(), Eq(n));
+        ASSERT_THAT(Y2.size(), Eq(n));
+        expectWithin(X, 1, maxCoord);
+        expectWithin(Y, 1, maxCoord);
+        expectWithin(X2, 1, maxCoord);
+        expectWithin(Y2, 1, maxCoord);
+        for (int i = 0; i < n; i++) {
+            for (int j = i + 1; j < n; j++) {
+                ASSERT_FALSE(intersects(X[i], Y[i], X2[i], Y2[i], X[j], Y[j], X2[j], Y2[j]));
+            }
+        }
+    }
+}
+
+TEST_F(GeometryGeneratorTests, NextNonIntersectingSegments_Failed) {
+    vector<long long> X2, Y2;
+    EXPECT_THROW(generator.nextNonIntersectingSegments(6, 1, 11, X, Y, X2, Y2), runtime_error);
+}
+
+TEST_F(GeometryGeneratorTests, Large) {
+    vector<long long> X2, Y2;
+    int n = 100000;
+    generator.nextPointsInGeneralPosition(n, -1000000000, 1000000000, X, Y);
+    EXPECT_THAT(X.size(), Eq(n));
+    generator.nextConvexPolygon(n, -1000000000, 1000000000, X, Y);
+    EXPECT_THAT(X.size(), Eq(n));
+    expectWithin(X, -1000000000, 1000000000);
+    generator.nextNonIntersectingSegments(n, -1000000000, 1000000000, X, Y, X2, Y2);
+    EXPECT_THAT(X.size(), Eq(n));
+}
+
+}
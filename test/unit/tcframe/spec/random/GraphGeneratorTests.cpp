@@ -0,0 +1,77 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/constraint/GraphConstraints.hpp"
+#include "tcframe/spec/random/GraphGenerator.hpp"
+
+using ::testing::Eq;
+using ::testing::Le;
+using ::testing::Test;
+
+namespace tcframe {
+
+class GraphGeneratorTests : public Test {
+protected:
+    Random rnd;
+    GraphGenerator generator = GraphGenerator(&rnd);
+    vector<int> U, V;
+};
+
+TEST_F(GraphGeneratorTests, NextTree_AllShapes) {
+    for (TreeShape shape : {TreeShape::RANDOM, TreeShape::RANDOM_ATTACHMENT, TreeShape::LINE,
+                            TreeShape::STAR, TreeShape::CATERPILLAR, TreeShape::BINARY}) {
+        for (int n : {1, 2, 3, 10, 1000}) {
+            generator.nextTree(n, U, V, shape);
+            EXPECT_TRUE(GraphConstraints::isTree(n, U, V));
+        }
+    }
+}
+
+TEST_F(GraphGeneratorTests, NextTree_FirstVertex) {
+    generator.nextTree(10, U, V, TreeShape::RANDOM, 0);
+    EXPECT_TRUE(GraphConstraints::isTree(10, U, V, 0));
+}
+
+TEST_F(GraphGeneratorTests, NextTree_Star) {
+    generator.nextTree(10, U, V, TreeShape::STAR);
+    vector<int> degrees(11);
+    for (int i = 0; i < 9; i++) {
+        degrees[U[i]]++;
+        degrees[V[i]]++;
+    }
+    EXPECT_THAT(*max_element(degrees.begin(), degrees.end()), Eq(9));
+}
+
+TEST_F(GraphGeneratorTests, NextTree_Binary) {
+    generator.nextTree(1000, U, V, TreeShape::BINARY);
+    vector<int> degrees(1001);
+    for (int i = 0; i < 999; i++) {
+        degrees[U[i]]++;
+        degrees[V[i]]++;
+    }
+    EXPECT_THAT(*max_element(degrees.begin(), degrees.end()), Le(3));
+}
+
+TEST_F(GraphGeneratorTests, NextTree_Invalid) {
+    EXPECT_THROW(generator.nextTree(0, U, V), runtime_error);
+}
+
+TEST_F(GraphGeneratorTests, NextConnectedGraph) {
+    for (long long m : {9LL, 20LL, 40LL, 45LL}) {
+        generator.nextConnectedGraph(10, m, U, V);
+        EXPECT_THAT(U.size(), Eq((size_t) m));
+        EXPECT_TRUE(GraphConstraints::isConnected(10, U, V));
+        EXPECT_TRUE(GraphConstraints::isSimpleGraph(10, U, V));
+    }
+}
+
+TEST_F(GraphGeneratorTests, NextConnectedGraph_Invalid) {
+    try {
+        generator.nextConnectedGraph(10, 8, U, V);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(string(e.what()), Eq("Connected graph with 10 vertices must have between 9 and 45 edges"));
+    }
+    EXPECT_THROW(generator.nextConnectedGraph(10, 46, U, V), runtime_error);
+}
+
+}
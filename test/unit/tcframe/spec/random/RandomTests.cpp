@@ -3,8 +3,11 @@
 #include "tcframe/spec/random/Random.hpp"
 
 #include <algorithm>
+#include <climits>
+#include <string>
 #include <vector>
 
+using std::string;
 using std::vector;
 
 using ::testing::Eq;
@@ -71,4 +74,145 @@ TEST_F(RandomTests, Seed) {
     EXPECT_THAT(a, Ne(b));
 }
 
+TEST_F(RandomTests, Xoshiro256_KnownValues) {
+    Xoshiro256 engine(42);
+    EXPECT_THAT(engine(), Eq(0x15780b2e0c2ec716ULL));
+    EXPECT_THAT(engine(), Eq(0x6104d9866d113a7eULL));
+    EXPECT_THAT(engine(), Eq(0xae17533239e499a1ULL));
+}
+
+TEST_F(RandomTests, FastEngine_KnownValues) {
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    rnd.setSeed(42);
+
+    vector<int> values;
+    for (int i = 0; i < 5; i++) {
+        values.push_back(rnd.nextInt(1, 100));
+    }
+    EXPECT_THAT(values, Eq(vector<int>{9, 38, 69, 93, 100}));
+}
+
+TEST_F(RandomTests, FastEngine_NextNumber) {
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    for (int i = 0; i < 1000; i++) {
+        int a = rnd.nextInt(-5, 5);
+        EXPECT_THAT(a, Ge(-5));
+        EXPECT_THAT(a, Le(5));
+
+        long long b = rnd.nextLongLong(-1000000000000ll, 1000000000000ll);
+        EXPECT_THAT(b, Ge(-1000000000000ll));
+        EXPECT_THAT(b, Le(1000000000000ll));
+
+        double c = rnd.nextDouble(100.0, 200.0);
+        EXPECT_THAT(c, Ge(100.0));
+        EXPECT_THAT(c, Le(200.0));
+    }
+
+    EXPECT_THAT(rnd.nextInt(7, 7), Eq(7));
+    rnd.nextInt(INT_MIN, INT_MAX);
+    rnd.nextLongLong(LLONG_MIN, LLONG_MAX);
+}
+
+TEST_F(RandomTests, SetEngine_RestartsFromSeed) {
+    rnd.setSeed(42);
+    int a = rnd.nextInt(1000000);
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    int b = rnd.nextInt(1000000);
+    rnd.setEngine(RandomEngine::MT19937);
+
+    EXPECT_THAT(rnd.nextInt(1000000), Eq(a));
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    EXPECT_THAT(rnd.nextInt(1000000), Eq(b));
+}
+
+TEST_F(RandomTests, Fork) {
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    Random child1 = rnd.fork(1);
+    rnd.nextInt(10);
+    Random child1Again = rnd.fork(1);
+    Random child2 = rnd.fork(2);
+
+    long long a = child1.nextLongLong(1000000000000ll);
+    EXPECT_THAT(child1Again.nextLongLong(1000000000000ll), Eq(a));
+    EXPECT_THAT(child2.nextLongLong(1000000000000ll), Ne(a));
+    EXPECT_THAT(child1.engineType(), Eq(RandomEngine::XOSHIRO256));
+}
+
+TEST_F(RandomTests, Split) {
+    Random other;
+    Random child1 = rnd.split();
+    Random child2 = rnd.split();
+    Random otherChild1 = other.split();
+
+    long long a = child1.nextLongLong(1000000000000ll);
+    EXPECT_THAT(otherChild1.nextLongLong(1000000000000ll), Eq(a));
+    EXPECT_THAT(child2.nextLongLong(1000000000000ll), Ne(a));
+}
+
+TEST_F(RandomTests, Bulk_SameAsSequential) {
+    for (RandomEngine engine : {RandomEngine::MT19937, RandomEngine::XOSHIRO256}) {
+        Random bulk, sequential;
+        bulk.setEngine(engine);
+        sequential.setEngine(engine);
+
+        // The ranges are chosen so that the fast engine often rejects and retries.
+        vector<int> ints = bulk.nextInts(1000, 0, 2000000000);
+        vector<long long> longLongs = bulk.nextLongLongs(1000, -5000000000000000000ll, 6000000000000000000ll);
+        vector<double> doubles = bulk.nextDoubles(1000, -1.0, 1.0);
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_THAT(ints[i], Eq(sequential.nextInt(0, 2000000000)));
+        }
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_THAT(longLongs[i], Eq(sequential.nextLongLong(-5000000000000000000ll, 6000000000000000000ll)));
+        }
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_THAT(doubles[i], Eq(sequential.nextDouble(-1.0, 1.0)));
+        }
+        EXPECT_THAT(bulk.nextInt(1000), Eq(sequential.nextInt(1000)));
+    }
+}
+
+TEST_F(RandomTests, FillInts_Range) {
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    int data[1000];
+    rnd.fillInts(data, data + 1000, -3, 3);
+    for (int x : data) {
+        EXPECT_THAT(x, Ge(-3));
+        EXPECT_THAT(x, Le(3));
+    }
+}
+
+TEST_F(RandomTests, NextString) {
+    string s = rnd.nextString(100, "ab");
+    EXPECT_THAT(s.size(), Eq(100u));
+    EXPECT_THAT(s.find_first_not_of("ab"), Eq(string::npos));
+    EXPECT_THAT(s.find('a'), Ne(string::npos));
+    EXPECT_THAT(s.find('b'), Ne(string::npos));
+}
+
+TEST_F(RandomTests, NextGrid) {
+    EXPECT_THAT(rnd.nextGrid(2, 3, 0.0), Eq(vector<vector<char>>(2, vector<char>(3, '.'))));
+    EXPECT_THAT(rnd.nextGrid(2, 3, 1.0, '1', '0'), Eq(vector<vector<char>>(2, vector<char>(3, '1'))));
+
+    vector<vector<char>> grid = rnd.nextGrid(100, 100, 0.5);
+    int filled = 0;
+    for (const vector<char>& row : grid) {
+        filled += (int) count(row.begin(), row.end(), '#');
+    }
+    EXPECT_THAT(filled, Ge(4000));
+    EXPECT_THAT(filled, Le(6000));
+}
+
+TEST_F(RandomTests, Shuffle_FastEngine) {
+    rnd.setEngine(RandomEngine::XOSHIRO256);
+    vector<int> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    rnd.shuffle(data.begin(), data.end());
+
+    // almost always true
+    EXPECT_THAT(data, Ne(vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    sort(data.begin(), data.end());
+    EXPECT_THAT(data, Eq(vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+}
+
 }
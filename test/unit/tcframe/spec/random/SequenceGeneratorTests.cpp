@@ -0,0 +1,55 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/constraint/VectorConstraints.hpp"
+#include "tcframe/spec/random/SequenceGenerator.hpp"
+
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Le;
+using ::testing::Test;
+
+namespace tcframe {
+
+class SequenceGeneratorTests : public Test {
+protected:
+    Random rnd;
+    SequenceGenerator generator = SequenceGenerator(&rnd);
+};
+
+TEST_F(SequenceGeneratorTests, NextPermutation) {
+    EXPECT_TRUE(VectorConstraints::isPermutation(generator.nextPermutation(1000)));
+
+    vector<int> permutation = generator.nextPermutation(5, 0);
+    sort(permutation.begin(), permutation.end());
+    EXPECT_THAT(permutation, Eq(vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(SequenceGeneratorTests, NextDistinct) {
+    vector<long long> values = generator.nextDistinct(1000, -1000000000000000000ll, 1000000000000000000ll);
+    EXPECT_THAT(values.size(), Eq(1000u));
+    EXPECT_TRUE(VectorConstraints::isStrictlySorted(values));
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(values, -1000000000000000000ll, 1000000000000000000ll));
+}
+
+TEST_F(SequenceGeneratorTests, NextDistinct_All) {
+    EXPECT_THAT(generator.nextDistinct(5, 3, 7), Eq(vector<long long>{3, 4, 5, 6, 7}));
+    EXPECT_THAT(generator.nextDistinct(0, 3, 7), Eq(vector<long long>{}));
+    EXPECT_THROW(generator.nextDistinct(6, 3, 7), runtime_error);
+}
+
+TEST_F(SequenceGeneratorTests, NextComposition) {
+    vector<long long> parts = generator.nextComposition(100, 10);
+    EXPECT_THAT(parts.size(), Eq(10u));
+    EXPECT_TRUE(VectorConstraints::sumBetween(parts, 100, 100));
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(parts, 1LL, 91LL));
+
+    parts = generator.nextComposition(100, 10, 5);
+    EXPECT_TRUE(VectorConstraints::sumBetween(parts, 100, 100));
+    EXPECT_TRUE(VectorConstraints::eachElementBetween(parts, 5LL, 55LL));
+
+    EXPECT_THAT(generator.nextComposition(30, 3, 10), Eq(vector<long long>{10, 10, 10}));
+    EXPECT_THAT(generator.nextComposition(7, 1), Eq(vector<long long>{7}));
+    EXPECT_THROW(generator.nextComposition(29, 3, 10), runtime_error);
+}
+
+}
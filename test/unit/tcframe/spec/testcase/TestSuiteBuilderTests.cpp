@@ -3,6 +3,7 @@
 #include "tcframe/spec/testcase/TestSuite.hpp"
 
 using ::testing::Eq;
+using ::testing::Ne;
 using ::testing::Test;
 
 namespace tcframe {
@@ -291,4 +292,27 @@ TEST_F(TestSuiteBuilderTests, Building_WithGroups_Both) {
     EXPECT_THAT(testSuite2, Eq(expected));
 }
 
+TEST_F(TestSuiteBuilderTests, Building_SharesSubtaskIds) {
+    TestSuite testSuite = builder
+            .newSampleTestCase()
+            .Subtasks({1, 2})
+            .Input({"10"})
+            .newTestGroup()
+            .Subtasks({1, 2})
+            .addOfficialTestCase([]{}, "N = 1")
+            .addOfficialTestCase([]{}, "N = 2")
+            .newTestGroup()
+            .Subtasks({3})
+            .addOfficialTestCase([]{}, "N = 3")
+            .build();
+
+    const auto& sample = testSuite.testGroups()[0].testCases();
+    const auto& group1 = testSuite.testGroups()[1].testCases();
+    const auto& group2 = testSuite.testGroups()[2].testCases();
+    EXPECT_THAT(group1[0].sharedSubtaskIds(), Eq(group1[1].sharedSubtaskIds()));
+    EXPECT_THAT(sample[0].sharedSubtaskIds(), Eq(group1[0].sharedSubtaskIds()));
+    EXPECT_THAT(group2[0].sharedSubtaskIds(), Ne(group1[0].sharedSubtaskIds()));
+    EXPECT_THAT(group2[0].subtaskIds(), Eq(set<int>{3}));
+}
+
 }
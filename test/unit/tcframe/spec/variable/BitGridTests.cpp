@@ -0,0 +1,86 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/BitGrid.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class BitGridTests : public Test {
+protected:
+    BitGrid grid = BitGrid('.', '#');
+};
+
+TEST_F(BitGridTests, Construction) {
+    EXPECT_THAT(grid.offChar(), Eq('.'));
+    EXPECT_THAT(grid.onChar(), Eq('#'));
+    EXPECT_THAT(grid.rows(), Eq(0));
+    EXPECT_THAT(BitGrid().onChar(), Eq('1'));
+}
+
+TEST_F(BitGridTests, Access) {
+    grid.assign(3, 70);
+    grid.set(1, 0, true);
+    grid.set(1, 69, true);
+    grid.set(2, 64, true);
+    grid.set(2, 64, false);
+
+    EXPECT_TRUE(grid.get(1, 0));
+    EXPECT_TRUE(grid.get(1, 69));
+    EXPECT_FALSE(grid.get(2, 64));
+    EXPECT_THAT(grid.wordsPerRow(), Eq(2));
+    EXPECT_THAT(grid.words().size(), Eq(6u));
+}
+
+TEST_F(BitGridTests, Count) {
+    grid.assign(2, 100, true);
+    grid.set(0, 99, false);
+
+    EXPECT_THAT(grid.count(), Eq(199));
+    EXPECT_THAT(grid.countRow(0), Eq(99));
+    EXPECT_THAT(grid.countRow(1), Eq(100));
+}
+
+TEST_F(BitGridTests, IsRowAll_IsColumnAll) {
+    grid.assign(3, 65);
+    grid.set(1, 64, true);
+
+    EXPECT_TRUE(grid.isRowAll(0, false));
+    EXPECT_FALSE(grid.isRowAll(1, false));
+    EXPECT_TRUE(grid.isColumnAll(0, false));
+    EXPECT_FALSE(grid.isColumnAll(64, false));
+
+    grid.assign(3, 65, true);
+    EXPECT_TRUE(grid.isRowAll(2, true));
+    EXPECT_TRUE(grid.isColumnAll(64, true));
+}
+
+TEST_F(BitGridTests, IsBorderAll) {
+    grid.assign(4, 4, true);
+    grid.set(1, 1, false);
+    grid.set(2, 2, false);
+    EXPECT_TRUE(grid.isBorderAll(true));
+
+    grid.set(3, 1, false);
+    EXPECT_FALSE(grid.isBorderAll(true));
+}
+
+TEST_F(BitGridTests, AddRow) {
+    grid.addRow({true, false});
+    grid.addRow({false, true});
+
+    EXPECT_THAT(grid.rows(), Eq(2));
+    EXPECT_THAT(grid.columns(), Eq(2));
+    EXPECT_TRUE(grid.get(1, 1));
+
+    try {
+        grid.addRow({true});
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Grid rows must have the same number of columns"));
+    }
+}
+
+}
@@ -0,0 +1,36 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/CharRowParser.hpp"
+
+#include <sstream>
+#include <string>
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::string;
+
+namespace tcframe {
+
+class CharRowParserTests : public Test {
+protected:
+    char row[4];
+};
+
+TEST_F(CharRowParserTests, Parsing) {
+    istringstream in("#.#.\n");
+    EXPECT_TRUE(CharRowParser::tryParse(&in, row, 4));
+    EXPECT_THAT(string(row, 4), Eq("#.#."));
+    EXPECT_THAT(in.peek(), Eq('\n'));
+}
+
+TEST_F(CharRowParserTests, Parsing_Failed_Rewinds) {
+    for (const char* input : {"#. .\n", "#.\n#.\n", "#.#", "\t...", ""}) {
+        istringstream in(input);
+        EXPECT_FALSE(CharRowParser::tryParse(&in, row, 4)) << input;
+        EXPECT_THAT(in.tellg(), Eq(0)) << input;
+    }
+}
+
+}
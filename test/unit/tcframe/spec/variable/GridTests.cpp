@@ -0,0 +1,70 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/Grid.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class GridTests : public Test {};
+
+TEST_F(GridTests, Construction) {
+    Grid<int> grid(2, 3, 7);
+
+    EXPECT_THAT(grid.rows(), Eq(2));
+    EXPECT_THAT(grid.columns(), Eq(3));
+    EXPECT_THAT(grid.elements(), Eq(vector<int>(6, 7)));
+    EXPECT_TRUE(Grid<int>().empty());
+}
+
+TEST_F(GridTests, Access) {
+    Grid<int> grid(2, 3);
+    grid[0][2] = 1;
+    grid[1][0] = 2;
+
+    const Grid<int>& constGrid = grid;
+    EXPECT_THAT(constGrid[0][2], Eq(1));
+    EXPECT_THAT(constGrid[1][0], Eq(2));
+    EXPECT_THAT(grid.elements(), Eq(vector<int>{0, 0, 1, 2, 0, 0}));
+}
+
+TEST_F(GridTests, Access_Bool) {
+    Grid<bool> grid(2, 2);
+    grid[1][1] = true;
+
+    EXPECT_FALSE(grid[0][1]);
+    EXPECT_TRUE(grid[1][1]);
+}
+
+TEST_F(GridTests, AddRow) {
+    Grid<int> grid;
+    grid.addRow({1, 2});
+    grid.addRow({3, 4});
+
+    EXPECT_THAT(grid.rows(), Eq(2));
+    EXPECT_THAT(grid.columns(), Eq(2));
+    EXPECT_THAT(grid[1][0], Eq(3));
+}
+
+TEST_F(GridTests, AddRow_Failed) {
+    Grid<int> grid;
+    grid.addRow({1, 2});
+
+    try {
+        grid.addRow({3});
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Grid rows must have the same number of columns"));
+    }
+}
+
+TEST_F(GridTests, Clear) {
+    Grid<int> grid(2, 3);
+    grid.clear();
+
+    EXPECT_THAT(grid, Eq(Grid<int>()));
+}
+
+}
@@ -0,0 +1,75 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/IntegerParser.hpp"
+
+#include <sstream>
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istringstream;
+
+namespace tcframe {
+
+class IntegerParserTests : public Test {
+protected:
+    int X;
+    long long Y;
+    char C;
+    unsigned U;
+};
+
+TEST_F(IntegerParserTests, Parsing) {
+    istringstream in("123 -45 +6 007");
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(123));
+    EXPECT_THAT(in.get(), Eq(' '));
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(-45));
+    in.get();
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(6));
+    in.get();
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(7));
+    EXPECT_TRUE(in.eof());
+}
+
+TEST_F(IntegerParserTests, Parsing_Limits) {
+    istringstream in("9223372036854775807 -9223372036854775808 2147483647 -2147483648");
+    EXPECT_TRUE(IntegerParser::tryParse(&in, Y));
+    EXPECT_THAT(Y, Eq(9223372036854775807LL));
+    in.get();
+    EXPECT_TRUE(IntegerParser::tryParse(&in, Y));
+    EXPECT_THAT(Y, Eq(-9223372036854775807LL - 1));
+    in.get();
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(2147483647));
+    in.get();
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(-2147483647 - 1));
+}
+
+TEST_F(IntegerParserTests, Parsing_StopsAtNonDigit) {
+    istringstream in("12ab");
+    EXPECT_TRUE(IntegerParser::tryParse(&in, X));
+    EXPECT_THAT(X, Eq(12));
+    EXPECT_THAT(in.peek(), Eq('a'));
+}
+
+TEST_F(IntegerParserTests, Parsing_Failed_Rewinds) {
+    for (const char* input : {"2147483648", "-2147483649", "-", "+x", "x", " 1"}) {
+        istringstream in(input);
+        EXPECT_FALSE(IntegerParser::tryParse(&in, X)) << input;
+        EXPECT_THAT(in.tellg(), Eq(0)) << input;
+    }
+}
+
+TEST_F(IntegerParserTests, Parsing_Unsupported) {
+    istringstream in("1");
+    EXPECT_FALSE(IntegerParser::tryParse(&in, C));
+    EXPECT_FALSE(IntegerParser::tryParse(&in, U));
+    EXPECT_THAT(in.peek(), Eq('1'));
+}
+
+}
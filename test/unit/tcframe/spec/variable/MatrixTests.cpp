@@ -10,6 +10,7 @@ using ::testing::Test;
 
 using std::istringstream;
 using std::ostringstream;
+using std::pair;
 
 namespace tcframe {
 
@@ -19,6 +20,14 @@ protected:
     vector<vector<char>> c;
     Matrix* M = Matrix::create(m, "M");
     Matrix* C = Matrix::create(c, "C");
+
+    Grid<int> g;
+    Grid<char> h;
+    Matrix* G = Matrix::create(g, "G");
+    Matrix* H = Matrix::create(h, "H");
+
+    BitGrid b = BitGrid('.', '#');
+    Matrix* B = Matrix::create(b, "B");
 };
 
 TEST_F(MatrixTests, Parsing_Successful) {
@@ -35,6 +44,35 @@ TEST_F(MatrixTests, Parsing_Char) {
     EXPECT_THAT(c, Eq(vector<vector<char>>{{'a', 'b', 'c'}, {'d', 'e', 'f'}}));
 }
 
+TEST_F(MatrixTests, Parsing_Char_Failed) {
+    vector<pair<string, string>> inputsAndErrors = {
+            {"abc\nd f\n", "Cannot parse for 'C[1][1]'. Found: <whitespace>"},
+            {"abc\nde\n", "Cannot parse for 'C[1][2]'. Found: <whitespace>"},
+            {"abc\nde", "Cannot parse for 'C[1][2]'. Found: <EOF>"}};
+
+    for (const pair<string, string>& inputAndError : inputsAndErrors) {
+        istringstream in(inputAndError.first);
+        c.clear();
+        try {
+            C->parseFrom(&in, 2, 3);
+            FAIL();
+        } catch (runtime_error& e) {
+            EXPECT_THAT(e.what(), StrEq(inputAndError.second));
+        }
+    }
+}
+
+TEST_F(MatrixTests, Parsing_Char_Failed_MissingNewline) {
+    istringstream in("abcd\n");
+
+    try {
+        C->parseFrom(&in, 1, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <newline> after 'C[0][2]'"));
+    }
+}
+
 TEST_F(MatrixTests, Parsing_Failed_MissingSpace) {
     istringstream in("1 2 3\n4\n");
 
@@ -129,4 +167,132 @@ TEST_F(MatrixTests, Printing_Char) {
     EXPECT_THAT(out.str(), Eq("abc\ndef\n"));
 }
 
+TEST_F(MatrixTests, Grid_Parsing_Successful) {
+    istringstream in("1 2 3\n4 5 6\n");
+    G->parseFrom(&in, 2, 3);
+
+    Grid<int> expected(2, 3);
+    expected[0][0] = 1, expected[0][1] = 2, expected[0][2] = 3;
+    expected[1][0] = 4, expected[1][1] = 5, expected[1][2] = 6;
+    EXPECT_THAT(g, Eq(expected));
+    EXPECT_THAT(G->rows(), Eq(2));
+    EXPECT_THAT(G->columns(1), Eq(3));
+}
+
+TEST_F(MatrixTests, Grid_Parsing_Char) {
+    istringstream in("abc\ndef\n");
+    H->parseFrom(&in, 2, 3);
+
+    EXPECT_THAT(h.elements(), Eq(vector<char>{'a', 'b', 'c', 'd', 'e', 'f'}));
+}
+
+TEST_F(MatrixTests, Grid_Parsing_Char_Failed) {
+    istringstream in("abc\nd f\n");
+
+    try {
+        H->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'H[1][1]'. Found: <whitespace>"));
+    }
+}
+
+TEST_F(MatrixTests, Grid_Parsing_Failed_MissingSpace) {
+    istringstream in("1 2 3\n4\n");
+
+    try {
+        G->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'G[1][0]'"));
+    }
+}
+
+TEST_F(MatrixTests, Grid_Parsing_WithoutSize_Rows_Successful) {
+    istringstream in("1 2\n3 4\n");
+    G->parseAndAddRowFrom(&in, 0);
+    WhitespaceManipulator::parseNewline(&in, "");
+    G->parseAndAddRowFrom(&in, 1);
+    WhitespaceManipulator::parseNewline(&in, "");
+
+    EXPECT_THAT(g.rows(), Eq(2));
+    EXPECT_THAT(g.elements(), Eq(vector<int>{1, 2, 3, 4}));
+}
+
+TEST_F(MatrixTests, Grid_Printing) {
+    g.assign(2, 3);
+    int value = 0;
+    for (int& element : g) {
+        element = ++value;
+    }
+    ostringstream out;
+    G->printTo(&out);
+
+    EXPECT_THAT(out.str(), Eq("1 2 3\n4 5 6\n"));
+}
+
+TEST_F(MatrixTests, Grid_Printing_Char) {
+    h.assign(2, 3, 'x');
+    h[1][2] = 'y';
+    ostringstream out;
+    H->printRowTo(0, &out);
+    out << endl;
+    H->printRowTo(1, &out);
+    out << endl;
+
+    EXPECT_THAT(out.str(), Eq("xxx\nxxy\n"));
+}
+
+TEST_F(MatrixTests, Grid_CanParseConcurrently) {
+    Grid<bool> flags;
+    EXPECT_TRUE(G->canParseConcurrently());
+    EXPECT_TRUE(H->canParseConcurrently());
+    EXPECT_FALSE(Matrix::create(flags, "flags")->canParseConcurrently());
+}
+
+TEST_F(MatrixTests, BitGrid_Parsing_Successful) {
+    istringstream in("#.#\n..#\n");
+    B->parseFrom(&in, 2, 3);
+
+    BitGrid expected('.', '#');
+    expected.assign(2, 3);
+    expected.set(0, 0, true);
+    expected.set(0, 2, true);
+    expected.set(1, 2, true);
+    EXPECT_THAT(b, Eq(expected));
+    EXPECT_THAT(B->columns(0), Eq(3));
+}
+
+TEST_F(MatrixTests, BitGrid_Parsing_Failed_UnknownCharacter) {
+    istringstream in("#.#\n.x#\n");
+
+    try {
+        B->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'B[1][1]'. Found: 'x'"));
+    }
+}
+
+TEST_F(MatrixTests, BitGrid_Parsing_Failed_Whitespace) {
+    istringstream in("#.#\n. #\n");
+
+    try {
+        B->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'B[1][1]'. Found: <whitespace>"));
+    }
+}
+
+TEST_F(MatrixTests, BitGrid_Printing) {
+    b.assign(2, 3);
+    b.set(0, 1, true);
+    b.set(1, 2, true);
+    ostringstream out;
+    B->printTo(&out);
+
+    EXPECT_THAT(out.str(), Eq(".#.\n..#\n"));
+}
+
 }
@@ -0,0 +1,128 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/Vector.hpp"
+
+#include <sstream>
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class StreamedVectorTests : public Test {
+protected:
+    StreamedVector<int> v = StreamedVector<int>([](int x) {return x % 2 == 1;});
+    Vector* V = Vector::create(v, "V");
+};
+
+TEST_F(StreamedVectorTests, Container) {
+    StreamedVector<int> u;
+    EXPECT_TRUE(u.empty());
+    EXPECT_TRUE(u.accepts(42));
+
+    u.push_back(1);
+    u.push_back(2);
+    EXPECT_THAT(u.size(), Eq(2));
+    EXPECT_THAT(u.back(), Eq(2));
+
+    u.clear();
+    EXPECT_TRUE(u.empty());
+    EXPECT_FALSE(u.hasProducer());
+
+    u.produce(3, [](int i) {return i * i;});
+    EXPECT_TRUE(u.hasProducer());
+    EXPECT_THAT(u.size(), Eq(3));
+    EXPECT_THAT(u.produceAt(2), Eq(4));
+    EXPECT_THAT(u.back(), Eq(4));
+}
+
+TEST_F(StreamedVectorTests, Parsing_Successful) {
+    istringstream in("1 3 5");
+    V->parseFrom(&in, 3);
+
+    EXPECT_THAT(V->size(), Eq(3));
+    EXPECT_THAT(v.back(), Eq(5));
+}
+
+TEST_F(StreamedVectorTests, Parsing_WithoutSize_Successful) {
+    istringstream in("1 3 5 7\n");
+    V->parseFrom(&in);
+
+    EXPECT_THAT(V->size(), Eq(4));
+    EXPECT_THAT(v.back(), Eq(7));
+}
+
+TEST_F(StreamedVectorTests, Parsing_Failed_Predicate) {
+    istringstream in("1 4 5");
+
+    try {
+        V->parseFrom(&in, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Element 'V[1]' does not satisfy its predicate"));
+    }
+}
+
+TEST_F(StreamedVectorTests, Parsing_Failed_MissingSpace) {
+    istringstream in("1 3");
+
+    try {
+        V->parseFrom(&in, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'V[1]'"));
+    }
+}
+
+TEST_F(StreamedVectorTests, Printing_Successful) {
+    v.produce(4, [](int i) {return 2 * i + 1;});
+    ostringstream out;
+    V->printTo(&out);
+
+    EXPECT_THAT(out.str(), Eq("1 3 5 7"));
+    EXPECT_THAT(V->size(), Eq(4));
+    EXPECT_THAT(v.back(), Eq(7));
+}
+
+TEST_F(StreamedVectorTests, Printing_Element_Successful) {
+    v.produce(2, [](int i) {return 2 * i + 5;});
+    ostringstream out;
+    V->printElementTo(0, &out);
+    out << '\n';
+    V->printElementTo(1, &out);
+
+    EXPECT_THAT(out.str(), Eq("5\n7"));
+}
+
+TEST_F(StreamedVectorTests, Printing_Failed_Predicate) {
+    v.produce(3, [](int i) {return i + 1;});
+    ostringstream out;
+
+    try {
+        V->printTo(&out);
+        FAIL();
+    } catch (FormattedError& e) {
+        EXPECT_THAT(e, Eq(FormattedError({
+                {0, "Does not satisfy constraints, on:"},
+                {1, "Element 'V[1]' does not satisfy its predicate"}})));
+    }
+}
+
+TEST_F(StreamedVectorTests, Printing_Failed_NoProducer) {
+    istringstream in("1");
+    V->parseFrom(&in, 1);
+    ostringstream out;
+
+    try {
+        V->printTo(&out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Streamed vector 'V' cannot be printed without a producer"));
+    }
+}
+
+}
@@ -0,0 +1,34 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/TokenContext.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class TokenContextTests : public Test {
+protected:
+    string name = "X";
+};
+
+TEST_F(TokenContextTests, Text) {
+    EXPECT_THAT(TokenContext("'X'").toString(), Eq("'X'"));
+    EXPECT_FALSE(TokenContext("'X'").empty());
+    EXPECT_TRUE(TokenContext().empty());
+}
+
+TEST_F(TokenContextTests, Variable) {
+    EXPECT_THAT(TokenContext::variable(name).toString(), Eq("'X'"));
+}
+
+TEST_F(TokenContextTests, VectorElement) {
+    EXPECT_THAT(TokenContext::vectorElement(name, 2).toString(), Eq("'X[2]'"));
+    EXPECT_FALSE(TokenContext::vectorElement(name, 2).empty());
+}
+
+TEST_F(TokenContextTests, MatrixElement) {
+    EXPECT_THAT(TokenContext::matrixElement(name, 2, 3).toString(), Eq("'X[2][3]'"));
+}
+
+}
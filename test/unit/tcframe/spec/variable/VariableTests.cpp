@@ -55,6 +55,26 @@ TEST_F(VariableTests, Parsing_Failed_Overflow) {
     }
 }
 
+TEST_F(VariableTests, Parsing_Failed_Overflow_Negative) {
+    istringstream in("-2147483649");
+    try {
+        Variable::parseValue(&in, X, "'X'");
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'X'. Found: '-2147483649'"));
+    }
+}
+
+TEST_F(VariableTests, Parsing_Failed_SignOnly) {
+    istringstream in("-x");
+    try {
+        Variable::parseValue(&in, X, "'X'");
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'X'. Found: '-x'"));
+    }
+}
+
 TEST_F(VariableTests, Parsing_Failed_TypeMismatch) {
     istringstream in("abc123");
     try {
@@ -108,4 +108,18 @@ TEST_F(VectorTests, Printing_Elements) {
     EXPECT_THAT(out.str(), Eq("1 2 3"));
 }
 
+TEST_F(VectorTests, CanParseConcurrently) {
+    vector<bool> flags;
+    EXPECT_TRUE(V->canParseConcurrently());
+    EXPECT_FALSE(Vector::create(flags, "flags")->canParseConcurrently());
+}
+
+TEST_F(VectorTests, Parsing_Raw) {
+    vector<string> lines;
+    Vector* L = Vector::createRaw(lines, "L");
+    istringstream in(" hello,  world ");
+    L->parseFrom(&in, 1);
+    EXPECT_THAT(lines, Eq(vector<string>{" hello,  world "}));
+}
+
 }
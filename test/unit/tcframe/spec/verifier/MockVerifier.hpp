@@ -11,6 +11,7 @@ public:
     MockVerifier()
             : Verifier(ConstraintSuite()) {}
 
+    MOCK_METHOD1(setCheckSubtaskAssignment, void(bool));
     MOCK_METHOD1(verifyConstraints, ConstraintsVerificationResult(const set<int>&));
     MOCK_METHOD0(verifyMultipleTestCasesConstraints, MultipleTestCasesConstraintsVerificationResult());
 };
@@ -12,6 +12,7 @@ namespace tcframe {
 class VerifierTests : public Test {
 public:
     static bool b0, b1, b2, b3, b4, b5;
+    static int evaluations;
 
 protected:
     ConstraintSuite constraintSuite = ConstraintSuiteBuilder()
@@ -37,6 +38,13 @@ protected:
             .addConstraint([=]{return b3;}, "1 <= C && C <= 10")
             .addConstraint([=]{return b4;}, "1 <= D && D <= 10")
             .build();
+    ConstraintSuite constraintSuiteWithSharedConstraints = ConstraintSuiteBuilder()
+            .newSubtask()
+            .addConstraint([=]{evaluations++; return b1;}, "1 <= A && A <= 10")
+            .addConstraint([=]{return b2;}, "1 <= B && B <= 10")
+            .newSubtask()
+            .addConstraint([=]{evaluations++; return b1;}, "1 <= A && A <= 10")
+            .build();
     ConstraintSuite constraintSuiteWithMultipleTestCasesConstraints = ConstraintSuiteBuilder()
             .addConstraint([=]{return b1;}, "1 <= A && A <= 10")
             .addConstraint([=]{return b2;}, "1 <= B && B <= 10")
@@ -47,10 +55,12 @@ protected:
     Verifier verifier = Verifier(constraintSuite);
     Verifier verifierWithSubtasks = Verifier(constraintSuiteWithSubtasks);
     Verifier verifierWithConstraintsAndSubtasks = Verifier(constraintSuiteWithConstraintsAndSubtasks);
+    Verifier verifierWithSharedConstraints = Verifier(constraintSuiteWithSharedConstraints);
     Verifier verifierWithMultipleTestCasesConstraints = Verifier(constraintSuiteWithMultipleTestCasesConstraints);
 
     void SetUp() {
         b0 = b1 = b2 = b3 = b4 = b5 = true;
+        evaluations = 0;
     }
 };
 
@@ -60,6 +70,7 @@ bool VerifierTests::b2;
 bool VerifierTests::b3;
 bool VerifierTests::b4;
 bool VerifierTests::b5;
+int VerifierTests::evaluations;
 
 TEST_F(VerifierTests, Verification_Valid_AllConstraintsValid) {
     ConstraintsVerificationResult result = verifier.verifyConstraints({Subtask::MAIN_ID});
@@ -79,6 +90,17 @@ TEST_F(VerifierTests, Verification_Invalid_SomeConstraintsInvalid) {
             Pair(Subtask::MAIN_ID, ElementsAre("1 <= B && B <= 10"))));
 }
 
+TEST_F(VerifierTests, Verification_Invalid_WithReason) {
+    Verifier verifierWithReason(ConstraintSuiteBuilder()
+            .addConstraint([=]{return ConstraintResult::violated("at [2]: 11");}, "eachElementBetween(A, 1, 10)")
+            .build());
+    ConstraintsVerificationResult result = verifierWithReason.verifyConstraints({Subtask::MAIN_ID});
+
+    EXPECT_FALSE(result.isValid());
+    EXPECT_THAT(result.unsatisfiedConstraintDescriptionsBySubtaskId(), ElementsAre(
+            Pair(Subtask::MAIN_ID, ElementsAre("eachElementBetween(A, 1, 10) (at [2]: 11)"))));
+}
+
 TEST_F(VerifierTests, Verification_WithSubtasks_Valid_AllConstraintsValid) {
     ConstraintsVerificationResult result = verifierWithSubtasks.verifyConstraints({1, 2, 3});
 
@@ -143,6 +165,40 @@ TEST_F(VerifierTests, Verification_WithConstraintsAndSubtasks_Invalid_GlobalCons
             Pair(Subtask::MAIN_ID, ElementsAre("1 <= X && X <= 10"))));
 }
 
+TEST_F(VerifierTests, Verification_WithSubtasks_WithoutSubtaskAssignmentCheck) {
+    verifierWithSubtasks.setCheckSubtaskAssignment(false);
+    ConstraintsVerificationResult result = verifierWithSubtasks.verifyConstraints({2});
+
+    EXPECT_TRUE(result.isValid());
+    EXPECT_THAT(result.satisfiedButNotAssignedSubtaskIds(), IsEmpty());
+    EXPECT_THAT(result.unsatisfiedConstraintDescriptionsBySubtaskId(), IsEmpty());
+}
+
+TEST_F(VerifierTests, Verification_WithSubtasks_WithoutSubtaskAssignmentCheck_Invalid) {
+    b4 = false;
+    verifierWithSubtasks.setCheckSubtaskAssignment(false);
+    ConstraintsVerificationResult result = verifierWithSubtasks.verifyConstraints({2});
+
+    EXPECT_FALSE(result.isValid());
+    EXPECT_THAT(result.satisfiedButNotAssignedSubtaskIds(), IsEmpty());
+    EXPECT_THAT(result.unsatisfiedConstraintDescriptionsBySubtaskId(), ElementsAre(
+            Pair(2, ElementsAre("1 <= D && D <= 10"))));
+}
+
+TEST_F(VerifierTests, Verification_WithSharedConstraints_EvaluatedOnce) {
+    b1 = false;
+    ConstraintsVerificationResult result = verifierWithSharedConstraints.verifyConstraints({1, 2});
+
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_FALSE(result.isValid());
+    EXPECT_THAT(result.unsatisfiedConstraintDescriptionsBySubtaskId(), ElementsAre(
+            Pair(1, ElementsAre("1 <= A && A <= 10")),
+            Pair(2, ElementsAre("1 <= A && A <= 10"))));
+
+    verifierWithSharedConstraints.verifyConstraints({1, 2});
+    EXPECT_EQ(evaluations, 2);
+}
+
 TEST_F(VerifierTests, Verification_MultipleTestCases_Valid_AllConstraintsValid) {
     MultipleTestCasesConstraintsVerificationResult result =
             verifierWithMultipleTestCasesConstraints.verifyMultipleTestCasesConstraints();
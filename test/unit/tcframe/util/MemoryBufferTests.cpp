@@ -0,0 +1,47 @@
+#include "gmock/gmock.h"
+
+#include <istream>
+#include <string>
+
+#include "tcframe/util/MemoryBuffer.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istream;
+using std::string;
+
+namespace tcframe {
+
+class MemoryBufferTests : public Test {
+protected:
+    string data = "12 34\n56";
+    MemoryBuffer buffer = {data.data(), data.data() + data.size()};
+    istream in{&buffer};
+};
+
+TEST_F(MemoryBufferTests, Reading) {
+    int a, b, c;
+    in >> a >> b >> c;
+    EXPECT_THAT(a, Eq(12));
+    EXPECT_THAT(b, Eq(34));
+    EXPECT_THAT(c, Eq(56));
+    EXPECT_TRUE(in.eof());
+}
+
+TEST_F(MemoryBufferTests, Seeking) {
+    in.seekg(3);
+    EXPECT_THAT((int) in.tellg(), Eq(3));
+    EXPECT_THAT(in.get(), Eq('3'));
+
+    in.seekg(-2, ios::end);
+    EXPECT_THAT(in.get(), Eq('5'));
+
+    in.seekg(-3, ios::cur);
+    EXPECT_THAT(in.get(), Eq('4'));
+
+    in.seekg(100);
+    EXPECT_TRUE(in.fail());
+}
+
+}